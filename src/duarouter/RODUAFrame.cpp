@@ -169,6 +169,22 @@ RODUAFrame::addDUAOptions() {
     oc.doRegister("persontrip.transfer.car-walk", new Option_String("parkingAreas"));
     oc.addDescription("persontrip.transfer.car-walk", "Processing", "Where are mode changes from car to walking allowed (possible values: 'parkingAreas', 'ptStops', 'allJunctions' and combinations)");
 
+    // register the settings for iterating with the simulation
+    oc.doRegister("dua.iterations", new Option_Integer(0));
+    oc.addDescription("dua.iterations", "Processing", "Alternate INT times between running the simulation as a separate process and rerouting with the measured travel times");
+
+    oc.doRegister("dua.simulation", new Option_String("sumo"));
+    oc.addDescription("dua.simulation", "Processing", "The simulation binary to run in each iteration");
+
+    oc.doRegister("dua.simulation-options", new Option_String(""));
+    oc.addDescription("dua.simulation-options", "Processing", "Further options (e.g. '--mesosim') to pass to the simulation");
+
+    oc.doRegister("dua.aggregation", new Option_String("900", "TIME"));
+    oc.addDescription("dua.aggregation", "Processing", "Aggregation period for the travel times measured in the simulation");
+
+    oc.doRegister("dua.prefix", new Option_FileName("dua"));
+    oc.addDescription("dua.prefix", "Processing", "Use FILE as prefix for the files exchanged with the simulation");
+
 }
 
 
@@ -212,6 +228,20 @@ RODUAFrame::checkOptions() {
         WRITE_ERROR("Routing algorithm '" + oc.getString("routing-algorithm") + "' does not support bulk routing.");
         return false;
     }
+    if (oc.getInt("dua.iterations") < 0) {
+        WRITE_ERROR("The number of iterations (--dua.iterations) must not be negative.");
+        return false;
+    }
+    if (oc.getInt("dua.iterations") > 0) {
+        if (oc.getString("weight-attribute") != "traveltime") {
+            WRITE_ERROR("Iterating with the simulation only supports weight-attribute 'traveltime'.");
+            return false;
+        }
+        if (oc.getString("routing-algorithm") == "CH" || oc.getString("routing-algorithm") == "CHWrapper") {
+            WRITE_ERROR("Routing algorithm '" + oc.getString("routing-algorithm") + "' does not support changing weights when iterating with the simulation.");
+            return false;
+        }
+    }
     if (oc.isDefault("routing-algorithm") && (oc.isSet("astar.all-distances") || oc.isSet("astar.landmark-distances") || oc.isSet("astar.save-landmark-distances"))) {
         oc.set("routing-algorithm", "astar");
     }
@@ -43,6 +43,8 @@
 #include <utils/common/SystemFrame.h>
 #include <utils/common/RandHelper.h>
 #include <utils/common/ToString.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/SysUtils.h>
 #include <utils/iodevices/OutputDevice.h>
 #include <utils/options/Option.h>
 #include <utils/options/OptionsCont.h>
@@ -89,6 +91,73 @@ initNet(RONet& net, ROLoader& loader, OptionsCont& oc) {
 
 
 
+/**
+ * Alternates simulation runs and rerouting keeping the network and the routes in memory
+ *
+ * The simulation runs as a separate process in each iteration. It reads the routes
+ *  from a plain route file and hands the travel times back via an edgeData dump.
+ */
+void
+iterate(RONet& net, ROLoader& loader, OptionsCont& oc, const RORouterProvider& provider) {
+    const std::string prefix = oc.getString("dua.prefix");
+    const std::string routeFile = prefix + ".rou.xml";
+    const std::string additionalFile = prefix + ".add.xml";
+    const std::string dumpFile = prefix + ".dump.xml";
+    // let the simulation measure the edge travel times
+    OutputDevice& add = OutputDevice::getDevice(additionalFile);
+    add.writeXMLHeader("additional", "additional_file.xsd");
+    add.openTag(SUMO_TAG_MEANDATA_EDGE).writeAttr(SUMO_ATTR_ID, "dua");
+    add.writeAttr(SUMO_ATTR_FREQUENCY, time2string(string2time(oc.getString("dua.aggregation"))));
+    // the dump file is given relative to the additional file
+    add.writeAttr(SUMO_ATTR_FILE, dumpFile.substr(FileHelpers::getFilePath(dumpFile).size()));
+    add.writeAttr(SUMO_ATTR_EXCLUDE_EMPTY, true);
+    add.close();
+    std::string cmd = "\"" + oc.getString("dua.simulation") + "\" --net-file \"" + oc.getString("net-file") +
+                      "\" --route-files \"" + routeFile + "\" --additional-files \"" + additionalFile;
+    if (oc.isSet("additional-files")) {
+        for (const std::string& file : oc.getStringVector("additional-files")) {
+            cmd += "," + file;
+        }
+    }
+    cmd += "\" --begin " + oc.getString("begin") + " --no-step-log";
+    if (!oc.isDefault("end")) {
+        cmd += " --end " + oc.getString("end");
+    }
+    if (oc.getString("dua.simulation-options") != "") {
+        cmd += " " + oc.getString("dua.simulation-options");
+    }
+    const std::vector<std::string> dumpFiles(1, dumpFile);
+    const int iterations = oc.getInt("dua.iterations");
+    for (int i = 0; i < iterations; i++) {
+        if (i > 0) {
+            PROGRESS_BEGIN_MESSAGE("Rerouting (iteration " + toString(i) + ")");
+            net.rerouteKept(oc, provider);
+            PROGRESS_DONE_MESSAGE();
+        }
+        OutputDevice& routes = OutputDevice::getDevice(routeFile);
+        routes.writeHeader<ROEdge>(SUMO_TAG_ROUTES);
+        net.writeKept(routes, oc);
+        routes.close();
+        PROGRESS_BEGIN_MESSAGE("Running the simulation (iteration " + toString(i) + ")");
+        if (SysUtils::runHiddenCommand(cmd) != 0) {
+            throw ProcessError("The simulation failed in iteration " + toString(i) + " (command '" + cmd + "').");
+        }
+        PROGRESS_DONE_MESSAGE();
+        // replace the travel times of the previous iteration
+        for (const auto& edge : net.getEdgeMap()) {
+            edge.second->resetTimeLines();
+        }
+        if (!loader.loadWeightFiles(net, dumpFiles, "traveltime", false, oc.getBool("weights.expand"))) {
+            throw ProcessError("Could not load the travel times of iteration " + toString(i) + ".");
+        }
+    }
+    // route once more using the travel times of the last simulation
+    PROGRESS_BEGIN_MESSAGE("Rerouting (iteration " + toString(iterations) + ")");
+    net.rerouteKept(oc, provider);
+    PROGRESS_DONE_MESSAGE();
+}
+
+
 /**
  * Computes the routes saving them
  */
@@ -206,7 +275,12 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
     // process route definitions
     try {
         net.openOutput(oc);
+        net.setKeepRoutables(oc.getInt("dua.iterations") > 0);
         loader.processRoutes(begin, end, string2time(oc.getString("route-steps")), net, provider);
+        if (oc.getInt("dua.iterations") > 0 && !MsgHandler::getErrorInstance()->wasInformed()) {
+            iterate(net, loader, oc, provider);
+            net.saveAndRemoveKept(oc);
+        }
         net.writeIntermodal(oc, provider.getIntermodalRouter());
         // end the processing
         net.cleanup();
@@ -296,6 +296,28 @@ Simulation::getParameter(const std::string& objectID, const std::string& key) {
         throw TraCIException("Parameter '" + key + "' is not supported.");
     }
 }
+
+
+void
+Simulation::saveSnapshot(const std::string& snapshotID) {
+    MSStateHandler::saveSnapshot(snapshotID, MSNet::getInstance()->getCurrentTimeStep());
+}
+
+
+void
+Simulation::restoreSnapshot(const std::string& snapshotID) {
+    try {
+        MSStateHandler::restoreSnapshot(snapshotID);
+    } catch (ProcessError& e) {
+        throw TraCIException(e.what());
+    }
+}
+
+
+void
+Simulation::cleanup() {
+    MSStateHandler::clearSnapshots();
+}
 }
 
 
@@ -78,6 +78,15 @@ public:
 
     static std::string getParameter(const std::string& objectID, const std::string& key);
 
+    /// @brief keeps the current state in memory under the given id (replacing an older snapshot with this id)
+    static void saveSnapshot(const std::string& snapshotID);
+
+    /// @brief resets the simulation to the state of the given snapshot
+    static void restoreSnapshot(const std::string& snapshotID);
+
+    /// @brief forgets all snapshots
+    static void cleanup();
+
 private:
     SubscribedValues mySubscribedValues;
     SubscribedContextValues mySubscribedContextValues;
@@ -313,6 +313,153 @@ ROMAAssignments::incremental(const int numIter, const bool verbose) {
 }
 
 
+void
+ROMAAssignments::computeBestPaths(const std::vector<ODCell*>& cells) {
+    std::string lastOrigin = "";
+    int workerIndex = 0;
+    for (std::vector<ODCell*>::const_iterator i = cells.begin(); i != cells.end(); i++) {
+        ODCell* const c = *i;
+        const SUMOTime begin = myAdditiveTraffic ? myBegin : c->begin;
+#ifdef HAVE_FOX
+        if (myNet.getThreadPool().size() > 0) {
+            if (lastOrigin != c->origin) {
+                workerIndex++;
+                if (workerIndex == myNet.getThreadPool().size()) {
+                    workerIndex = 0;
+                }
+                myNet.getThreadPool().add(new RONet::BulkmodeTask(false), workerIndex);
+                lastOrigin = c->origin;
+                myNet.getThreadPool().add(new RoutingTask(*this, c, begin, 0.), workerIndex);
+                myNet.getThreadPool().add(new RONet::BulkmodeTask(true), workerIndex);
+            } else {
+                myNet.getThreadPool().add(new RoutingTask(*this, c, begin, 0.), workerIndex);
+            }
+            continue;
+        }
+#endif
+        if (lastOrigin != c->origin) {
+            myRouter.setBulkMode(false);
+            lastOrigin = c->origin;
+        }
+        ConstROEdgeVector edges;
+        myRouter.compute(myNet.getEdge(c->origin + "-source"), myNet.getEdge(c->destination + "-sink"), myDefaultVehicle, begin, edges);
+        myRouter.setBulkMode(true);
+        addRoute(edges, c->pathsVector, c->origin + c->destination + toString(c->pathsVector.size()), 0.);
+    }
+#ifdef HAVE_FOX
+    if (myNet.getThreadPool().size() > 0) {
+        myNet.getThreadPool().waitAll();
+    }
+#endif
+    myRouter.setBulkMode(false);
+}
+
+
+double
+ROMAAssignments::getObjectiveDerivative(const std::vector<ROMAEdge*>& edges, const double begin, const double intervalLengthInHours, const double step) const {
+    double result = 0.;
+    for (std::vector<ROMAEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+        const double flow = (*i)->getFlow(begin);
+        const double diff = (*i)->getHelpFlow(begin) - flow;
+        if (diff != 0.) {
+            result += diff * capacityConstraintFunction(*i, (flow + step * diff) / intervalLengthInHours);
+        }
+    }
+    return result;
+}
+
+
+void
+ROMAAssignments::ue(const int maxIterations, const double relGap, const bool verbose) {
+    // the cells of each time slot (all cells share a single slot for additive traffic)
+    std::map<SUMOTime, std::vector<ODCell*> > slots;
+    for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
+        slots[myAdditiveTraffic ? myBegin : (*i)->begin].push_back(*i);
+    }
+    std::vector<ROMAEdge*> edges;
+    for (std::map<std::string, ROEdge*>::const_iterator i = myNet.getEdgeMap().begin(); i != myNet.getEdgeMap().end(); ++i) {
+        edges.push_back(static_cast<ROMAEdge*>(i->second));
+    }
+    for (std::map<SUMOTime, std::vector<ODCell*> >::const_iterator slot = slots.begin(); slot != slots.end(); ++slot) {
+        const std::vector<ODCell*>& cells = slot->second;
+        const double begin = STEPS2TIME(slot->first);
+        const double end = STEPS2TIME(myAdditiveTraffic ? myEnd : cells.front()->end);
+        const double intervalLengthInHours = (end - begin) / 3600.;
+        if (verbose) {
+            WRITE_MESSAGE(" starting interval " + time2string(slot->first));
+        }
+        double gap = 1.;
+        int iteration = 0;
+        for (; iteration < maxIterations; iteration++) {
+            // travel times for the current flows
+            for (std::vector<ROMAEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+                (*i)->addTravelTime(capacityConstraintFunction(*i, (*i)->getFlow(begin) / intervalLengthInHours), begin, end);
+                (*i)->setHelpFlow(begin, end, 0.);
+            }
+            // all-or-nothing assignment to the shortest paths
+            computeBestPaths(cells);
+            for (std::vector<ODCell*>::const_iterator i = cells.begin(); i != cells.end(); ++i) {
+                const ConstROEdgeVector& route = (*i)->pathsVector.back()->getEdgeVector();
+                for (ConstROEdgeVector::const_iterator e = route.begin(); e != route.end(); ++e) {
+                    ROMAEdge* edge = static_cast<ROMAEdge*>(myNet.getEdge((*e)->getID()));
+                    edge->setHelpFlow(begin, end, edge->getHelpFlow(begin) + (*i)->vehicleNumber);
+                }
+            }
+            double step = 1.;
+            if (iteration > 0) {
+                // relative gap between the total travel time and the travel time on the shortest paths
+                double totalTime = 0.;
+                double shortestTime = 0.;
+                for (std::vector<ROMAEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+                    const double travelTime = capacityConstraintFunction(*i, (*i)->getFlow(begin) / intervalLengthInHours);
+                    totalTime += (*i)->getFlow(begin) * travelTime;
+                    shortestTime += (*i)->getHelpFlow(begin) * travelTime;
+                }
+                gap = totalTime > 0. ? (totalTime - shortestTime) / totalTime : 0.;
+                if (verbose) {
+                    WRITE_MESSAGE("  iteration " + toString(iteration) + ": relative gap " + toString(gap));
+                }
+                if (gap <= relGap) {
+                    break;
+                }
+                // bisection for the step minimizing the objective
+                if (getObjectiveDerivative(edges, begin, intervalLengthInHours, 1.) > 0.) {
+                    double lower = 0.;
+                    double upper = 1.;
+                    for (int i = 0; i < 30; i++) {
+                        step = (lower + upper) / 2.;
+                        if (getObjectiveDerivative(edges, begin, intervalLengthInHours, step) > 0.) {
+                            upper = step;
+                        } else {
+                            lower = step;
+                        }
+                    }
+                }
+            }
+            // move the path flows and the edge flows
+            for (std::vector<ODCell*>::const_iterator i = cells.begin(); i != cells.end(); ++i) {
+                for (std::vector<RORoute*>::const_iterator j = (*i)->pathsVector.begin(); j != (*i)->pathsVector.end(); ++j) {
+                    (*j)->setProbability((*j)->getProbability() * (1. - step));
+                }
+                (*i)->pathsVector.back()->addProbability(step * (*i)->vehicleNumber);
+            }
+            for (std::vector<ROMAEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+                const double flow = (*i)->getFlow(begin);
+                (*i)->setFlow(begin, end, flow + step * ((*i)->getHelpFlow(begin) - flow));
+            }
+        }
+        if (iteration == maxIterations && maxIterations > 1) {
+            WRITE_WARNING("User equilibrium for interval " + time2string(slot->first) + " not reached after " + toString(maxIterations) + " iterations (relative gap " + toString(gap) + ").");
+        }
+        // travel times for the final flows
+        for (std::vector<ROMAEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+            (*i)->addTravelTime(capacityConstraintFunction(*i, (*i)->getFlow(begin) / intervalLengthInHours), begin, end);
+            (*i)->setHelpFlow(begin, end, 0.);
+        }
+    }
+}
+
+
 void
 ROMAAssignments::sue(const int maxOuterIteration, const int maxInnerIteration, const int kPaths, const double penalty, const double tolerance, const std::string /* routeChoiceMethod */) {
     getKPaths(kPaths, penalty);
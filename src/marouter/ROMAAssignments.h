@@ -77,8 +77,19 @@ public:
     // @brief incremental method
     void incremental(const int numIter, const bool verbose);
 
-    // @brief UE method
-    void ue();
+    /** @brief UE method (path based Frank-Wolfe algorithm)
+     *
+     * Each iteration assigns the demand of all cells to the current shortest
+     *  paths (all-or-nothing) and moves the flows towards this solution by the
+     *  step size minimizing the Beckmann objective. The routes of a cell are
+     *  the shortest paths found so far with their flows as probabilities.
+     *  Time slots are assigned independently unless the traffic is additive.
+     *
+     * @param[in] maxIterations The maximum number of iterations per time slot
+     * @param[in] relGap The relative gap to reach for stopping
+     * @param[in] verbose Whether the relative gap shall be reported for every iteration
+     */
+    void ue(const int maxIterations, const double relGap, const bool verbose);
 
     // @brief SUE method
     void sue(const int maxOuterIteration, const int maxInnerIteration, const int kPaths, const double penalty, const double tolerance, const std::string routeChoiceMethod);
@@ -129,6 +140,12 @@ private:
     /// @brief get the k shortest paths
     void getKPaths(const int kPaths, const double penalty);
 
+    /// @brief adds the current shortest path of each cell (without flow), in parallel if routing threads are available
+    void computeBestPaths(const std::vector<ODCell*>& cells);
+
+    /// @brief the derivative of the Beckmann objective along the direction from the current to the auxiliary flows
+    double getObjectiveDerivative(const std::vector<ROMAEdge*>& edges, const double begin, const double intervalLengthInHours, const double step) const;
+
 private:
     const SUMOTime myBegin;
     const SUMOTime myEnd;
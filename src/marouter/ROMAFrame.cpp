@@ -225,7 +225,7 @@ ROMAFrame::addAssignmentOptions() {
     oc.addDescription("assignment-method", "Processing", "Choose a assignment method: incremental, UE or SUE");
 
     oc.doRegister("tolerance", new Option_Float(double(0.001)));
-    oc.addDescription("tolerance", "Processing", "Use FLOAT as tolerance when checking for SUE stability");
+    oc.addDescription("tolerance", "Processing", "Use FLOAT as tolerance when checking for SUE stability and as the relative gap for UE convergence");
 
     oc.doRegister("left-turn-penalty", new Option_Float(0.));
     oc.addDescription("left-turn-penalty", "Processing", "Use left-turn penalty FLOAT to calculate link travel time when searching routes");
@@ -245,7 +245,7 @@ ROMAFrame::addAssignmentOptions() {
     oc.addDescription("lowerbound", "Processing", "Use FLOAT as the lower bound to determine auxiliary link cost");
 
     oc.doRegister("max-iterations", 'i', new Option_Integer(20));
-    oc.addDescription("max-iterations", "Processing", "maximal number of iterations for new route searching in incremental and stochastic user assignment");
+    oc.addDescription("max-iterations", "Processing", "maximal number of iterations for new route searching in incremental, user equilibrium and stochastic user assignment");
 
     oc.doRegister("max-inner-iterations", new Option_Integer(1000));
     oc.addDescription("max-inner-iterations", "Processing", "maximal number of inner iterations for user equilibrium calcuation in the stochastic user assignment");
@@ -301,6 +301,8 @@ computeRoutes(RONet& net, OptionsCont& oc, ODMatrix& matrix) {
         const std::string assignMethod = oc.getString("assignment-method");
         if (assignMethod == "incremental") {
             a.incremental(oc.getInt("max-iterations"), oc.getBool("verbose"));
+        } else if (assignMethod == "UE") {
+            a.ue(oc.getInt("max-iterations"), oc.getFloat("tolerance"), oc.getBool("verbose"));
         } else if (assignMethod == "SUE") {
             a.sue(oc.getInt("max-iterations"), oc.getInt("max-inner-iterations"),
                   oc.getInt("paths"), oc.getFloat("paths.penalty"), oc.getFloat("tolerance"), oc.getString("route-choice-method"));
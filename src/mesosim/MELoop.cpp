@@ -29,6 +29,7 @@
 #include <vector>
 #include <map>
 #include <cmath>
+#include <algorithm>
 
 #include <microsim/MSNet.h>
 #include <microsim/MSEdge.h>
@@ -49,7 +50,17 @@
 // ===========================================================================
 // method definitions
 // ===========================================================================
-MELoop::MELoop(const SUMOTime recheckInterval) : myFullRecheckInterval(recheckInterval), myLinkRecheckInterval(TIME2STEPS(1)) {
+MELoop::MELoop(const SUMOTime recheckInterval, const int numThreads) :
+    myLeaderCars(MAX2(1, numThreads)),
+    myDeferredCars(MAX2(1, numThreads)),
+    myFullRecheckInterval(recheckInterval), myLinkRecheckInterval(TIME2STEPS(1)) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        while (myThreadPool.size() < numThreads) {
+            new FXWorkerThread(myThreadPool);
+        }
+    }
+#endif
 }
 
 MELoop::~MELoop() {
@@ -65,19 +76,151 @@ MELoop::~MELoop() {
 
 void
 MELoop::simulate(SUMOTime tMax) {
-    while (!myLeaderCars.empty()) {
-        const SUMOTime time = myLeaderCars.begin()->first;
+    if (myLeaderCars.size() > 1) {
+        simulateParallel(tMax);
+        return;
+    }
+    LeaderCarQueue& leaderCars = myLeaderCars.front();
+    while (!leaderCars.empty()) {
+        const SUMOTime time = leaderCars.topTime();
         assert(time > tMax - DELTA_T);
         if (time > tMax) {
             return;
         }
-        std::vector<MEVehicle*> vehs = myLeaderCars[time];
-        myLeaderCars.erase(time);
-        for (std::vector<MEVehicle*>::const_iterator i = vehs.begin(); i != vehs.end(); ++i) {
-            checkCar(*i);
-            assert(myLeaderCars.empty() || myLeaderCars.begin()->first >= time);
+        checkCar(leaderCars.pop());
+        assert(leaderCars.empty() || leaderCars.topTime() >= time);
+    }
+}
+
+
+void
+MELoop::simulateParallel(SUMOTime tMax) {
+    if (myEdgeRegions.empty()) {
+        partition();
+    }
+    const int numRegions = (int)myLeaderCars.size();
+    bool active = true;
+    while (active) {
+        // the regions move their vehicles within the edges concurrently ...
+        for (int r = 0; r < numRegions; r++) {
+            if (!myLeaderCars[r].empty() && myLeaderCars[r].topTime() <= tMax) {
+#ifdef HAVE_FOX
+                myThreadPool.add(new RegionTask(*this, r, tMax));
+#else
+                simulateRegion(r, tMax);
+#endif
+            }
+        }
+#ifdef HAVE_FOX
+        myThreadPool.waitAll();
+#endif
+        // ... and all other events are processed sequentially in a deterministic order
+        std::vector<MEVehicle*> deferred;
+        for (int r = 0; r < numRegions; r++) {
+            deferred.insert(deferred.end(), myDeferredCars[r].begin(), myDeferredCars[r].end());
+            myDeferredCars[r].clear();
+        }
+        std::stable_sort(deferred.begin(), deferred.end(), [](const MEVehicle * const a, const MEVehicle * const b) {
+            return a->getEventTime() < b->getEventTime();
+        });
+        for (MEVehicle* const veh : deferred) {
+            checkCar(veh);
+        }
+        // the sequential events may have created new local events
+        active = false;
+        for (int r = 0; r < numRegions; r++) {
+            if (!myLeaderCars[r].empty() && myLeaderCars[r].topTime() <= tMax) {
+                active = true;
+            }
+        }
+    }
+}
+
+
+void
+MELoop::simulateRegion(const int region, SUMOTime tMax) {
+    LeaderCarQueue& leaderCars = myLeaderCars[region];
+    std::vector<MEVehicle*>& deferred = myDeferredCars[region];
+    while (!leaderCars.empty() && leaderCars.topTime() <= tMax) {
+        MEVehicle* const veh = leaderCars.pop();
+        if (!checkCarLocal(veh)) {
+            deferred.push_back(veh);
+        }
+    }
+}
+
+
+#ifdef HAVE_FOX
+void
+MELoop::RegionTask::run(FXWorkerThread* /* context */) {
+    myLoop.simulateRegion(myRegion, myTMax);
+}
+#endif
+
+
+void
+MELoop::partition() {
+    const MSEdgeVector& edges = MSEdge::getAllEdges();
+    const int numRegions = (int)myLeaderCars.size();
+    std::vector<int> segmentCounts(edges.size(), 0);
+    int numSegments = 0;
+    for (int i = 0; i < (int)edges.size() && i < (int)myEdges2FirstSegments.size(); i++) {
+        for (MESegment* s = myEdges2FirstSegments[i]; s != 0; s = s->getNextSegment()) {
+            segmentCounts[i]++;
+        }
+        numSegments += segmentCounts[i];
+    }
+    // grow the regions breadth first along the (undirected) edge graph
+    const int target = numSegments / numRegions + 1;
+    myEdgeRegions.assign(edges.size(), -1);
+    int region = 0;
+    int size = 0;
+    for (const MSEdge* const start : edges) {
+        std::queue<const MSEdge*> queue;
+        queue.push(start);
+        while (!queue.empty()) {
+            const MSEdge* const edge = queue.front();
+            queue.pop();
+            if (myEdgeRegions[edge->getNumericalID()] >= 0) {
+                continue;
+            }
+            myEdgeRegions[edge->getNumericalID()] = region;
+            size += segmentCounts[edge->getNumericalID()];
+            if (size >= target && region < numRegions - 1) {
+                region++;
+                size = 0;
+            }
+            for (const MSEdge* const succ : edge->getSuccessors()) {
+                if (myEdgeRegions[succ->getNumericalID()] < 0) {
+                    queue.push(succ);
+                }
+            }
+            for (const MSEdge* const pred : edge->getPredecessors()) {
+                if (myEdgeRegions[pred->getNumericalID()] < 0) {
+                    queue.push(pred);
+                }
+            }
         }
     }
+    // move the vehicles scheduled so far to their regions
+    LeaderCarQueue scheduled;
+    std::swap(scheduled, myLeaderCars.front());
+    while (!scheduled.empty()) {
+        const SUMOTime time = scheduled.topTime();
+        MEVehicle* const veh = scheduled.pop();
+        myLeaderCars[getRegion(veh)].push(time, veh);
+    }
+}
+
+
+int
+MELoop::getRegion(const MEVehicle* veh) const {
+    if (myEdgeRegions.empty()) {
+        return 0;
+    }
+    // teleporting vehicles have no segment
+    const MSEdge* const edge = veh->getSegment() != 0 ? &veh->getSegment()->getEdge() : veh->getEdge();
+    return myEdgeRegions[edge->getNumericalID()];
 }
 
 
@@ -125,6 +268,46 @@ MELoop::checkCar(MEVehicle* veh) {
         teleportVehicle(veh, toSegment);
         return;
     }
+    blockCar(veh, toSegment);
+}
+
+
+bool
+MELoop::checkCarLocal(MEVehicle* veh) {
+    MESegment* const onSegment = veh->getSegment();
+    if (onSegment == 0 || veh->hasStops() || veh->hasSharedMoveReminders() || veh->succEdge(1) == 0) {
+        return false;
+    }
+    MESegment* toSegment = onSegment->getNextSegment();
+    if (toSegment == 0) {
+        // crossing the junction without a link to an edge of the same region, not arriving there
+        const MSEdge* const nextEdge = veh->succEdge(1);
+        if (onSegment->hasLinkControl() || veh->succEdge(2) == 0 || nextEdge->isVaporizing()
+                || myEdgeRegions[nextEdge->getNumericalID()] != getRegion(veh)) {
+            return false;
+        }
+        toSegment = myEdges2FirstSegments[nextEdge->getNumericalID()];
+    }
+    if (toSegment->hasDetectors() || toSegment->hasLinkControl()) {
+        return false;
+    }
+    const SUMOTime leaveTime = veh->getEventTime();
+    if (changeSegment(veh, leaveTime, toSegment)) {
+        return true;
+    }
+    if (MSGlobals::gTimeToGridlock > 0 && veh->getWaitingTime() > MSGlobals::gTimeToGridlock) {
+        // teleports are handled sequentially
+        return false;
+    }
+    blockCar(veh, toSegment);
+    return true;
+}
+
+
+void
+MELoop::blockCar(MEVehicle* veh, MESegment* const toSegment) {
+    const SUMOTime leaveTime = veh->getEventTime();
+    MESegment* const onSegment = veh->getSegment();
     if (veh->getBlockTime() == SUMOTime_MAX) {
         veh->setBlockTime(leaveTime);
     }
@@ -200,7 +383,7 @@ MELoop::teleportVehicle(MEVehicle* veh, MESegment* const toSegment) {
 
 void
 MELoop::addLeaderCar(MEVehicle* veh, MSLink* link) {
-    myLeaderCars[veh->getEventTime()].push_back(veh);
+    myLeaderCars[getRegion(veh)].push(veh->getEventTime(), veh);
     setApproaching(veh, link);
 }
 
@@ -220,8 +403,7 @@ MELoop::setApproaching(MEVehicle* veh, MSLink* link) {
 
 void
 MELoop::removeLeaderCar(MEVehicle* v) {
-    std::vector<MEVehicle*>& cands = myLeaderCars[v->getEventTime()];
-    cands.erase(find(cands.begin(), cands.end(), v));
+    myLeaderCars[getRegion(v)].remove(v->getEventTime(), v);
 }
 
 
@@ -30,6 +30,12 @@
 #include <vector>
 #include <map>
 
+#include <utils/common/CalendarQueue.h>
+
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
 
 // ===========================================================================
 // class declarations
@@ -52,8 +58,12 @@ class OptionsCont;
  */
 class MELoop {
 public:
-    /// SUMO constructor
-    MELoop(const SUMOTime recheckInterval);
+    /** @brief SUMO constructor
+     *
+     * @param[in] recheckInterval The interval at which to recheck at full segments
+     * @param[in] numThreads The number of regions simulated in parallel (0 for sequential simulation)
+     */
+    MELoop(const SUMOTime recheckInterval, const int numThreads = 0);
 
     ~MELoop();
 
@@ -119,6 +129,42 @@ private:
      */
     void checkCar(MEVehicle* veh);
 
+    /** @brief Check whether the vehicle may move within its region, called by the region threads
+     *
+     * Only moves which touch nothing but segments and vehicles of the region are done.
+     *  This excludes links (junction control and penalties), arrivals, stops, teleports,
+     *  detectors and devices which share data with other vehicles.
+     *
+     * @param[in] veh The vehicle to check
+     * @return Whether the vehicle was handled, false means it has to be checked sequentially
+     */
+    bool checkCarLocal(MEVehicle* veh);
+
+    /** @brief Reschedules a vehicle which could not move to its next segment
+     *
+     * @param[in] veh The vehicle to reschedule
+     * @param[in] toSegment The segment the vehicle wants to enter
+     */
+    void blockCar(MEVehicle* veh, MESegment* const toSegment);
+
+    /// @brief returns the region responsible for the vehicle's event
+    int getRegion(const MEVehicle* veh) const;
+
+    /// @brief assigns all edges to the regions by growing connected sets of similar size
+    void partition();
+
+    /// @brief processes the events of all regions in parallel up to the given time
+    void simulateParallel(SUMOTime tMax);
+
+    /** @brief processes the local events of a region up to the given time
+     *
+     * Events which cannot be handled locally are collected for the sequential phase.
+     *
+     * @param[in] region The index of the region
+     * @param[in] tMax the end time for the sim step
+     */
+    void simulateRegion(const int region, SUMOTime tMax);
+
     /** @brief Retrieve next segment
      *
      * If the segment is not the last on the current edge, its successor is returned.
@@ -140,8 +186,41 @@ private:
     void teleportVehicle(MEVehicle* veh, MESegment* const toSegment);
 
 private:
-    /// @brief leader cars in the segments sorted by exit time
-    std::map<SUMOTime, std::vector<MEVehicle*> > myLeaderCars;
+#ifdef HAVE_FOX
+    /**
+     * @class RegionTask
+     * @brief Processes the local events of a region in a worker thread
+     */
+    class RegionTask : public FXWorkerThread::Task {
+    public:
+        RegionTask(MELoop& loop, const int region, const SUMOTime tMax) :
+            myLoop(loop), myRegion(region), myTMax(tMax) {}
+        void run(FXWorkerThread* context);
+    private:
+        MELoop& myLoop;
+        const int myRegion;
+        const SUMOTime myTMax;
+    private:
+        /// @brief Invalidated assignment operator.
+        RegionTask& operator=(const RegionTask&);
+    };
+#endif
+
+    typedef CalendarQueue<MEVehicle*> LeaderCarQueue;
+
+    /// @brief leader cars in the segments sorted by exit time (one container per region)
+    std::vector<LeaderCarQueue> myLeaderCars;
+
+    /// @brief leader cars of each region which need to be checked sequentially
+    std::vector<std::vector<MEVehicle*> > myDeferredCars;
+
+    /// @brief mapping from edge ids to regions (empty if not partitioned yet)
+    std::vector<int> myEdgeRegions;
+
+#ifdef HAVE_FOX
+    /// @brief the threads for simulating the regions
+    FXWorkerThread::Pool myThreadPool;
+#endif
 
     /// @brief mapping from internal edge ids to their initial segments
     std::vector<MESegment*> myEdges2FirstSegments;
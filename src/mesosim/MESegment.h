@@ -97,6 +97,20 @@ public:
      */
     void removeDetector(MSMoveReminder* data);
 
+    /** @brief Returns whether data collectors are registered on this segment
+     * @return Whether a detector is added
+     */
+    inline bool hasDetectors() const {
+        return !myDetectorData.empty();
+    }
+
+    /** @brief Returns whether vehicles on this segment interact with a link
+     * @return Whether junction control or a link penalty applies
+     */
+    inline bool hasLinkControl() const {
+        return myJunctionControl || myTLSPenalty || myMinorPenalty;
+    }
+
     /** @brief Updates data of a detector for all vehicle queues
      *
      * @param[in] data The detector data to update
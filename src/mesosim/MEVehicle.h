@@ -179,6 +179,26 @@ public:
      */
     SUMOTime getStoptime(const MESegment* const seg, SUMOTime time) const;
 
+    /** @brief Returns whether the vehicle has any stops left
+     * @return whether stops are defined for any segment
+     */
+    inline bool hasStops() const {
+        return !myStops.empty();
+    }
+
+    /** @brief Returns whether any move reminders (detectors or devices) share data with other vehicles
+     * @return whether the vehicle has move reminders which are not local to the vehicle
+     * @see MSMoveReminder::isVehicleLocal
+     */
+    inline bool hasSharedMoveReminders() const {
+        for (MoveReminderCont::const_iterator rem = myMoveReminders.begin(); rem != myMoveReminders.end(); ++rem) {
+            if (!rem->first->isVehicleLocal()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
 
     /** @brief Returns the list of still pending stop edges
      */
@@ -251,6 +251,8 @@ MSEdge::rebuildAllowedLanes() {
     }
     myClassedAllowed.clear();
     myClassesSuccessorMap.clear();
+    // the best lanes of the vehicles depend on the permissions
+    MSVehicle::clearBestLanesCache();
     // rebuild myMinimumPermissions and myCombinedPermissions
     myMinimumPermissions = SVCAll;
     myCombinedPermissions = 0;
@@ -784,6 +786,7 @@ MSEdge::clear() {
     }
     myDict.clear();
     myEdges.clear();
+    MSVehicle::clearBestLanesCache();
 }
 
 
@@ -30,6 +30,8 @@
 #endif
 
 #include <cassert>
+#include <set>
+#include <algorithm>
 #include "MSEventControl.h"
 #include <utils/common/MsgHandler.h>
 #include <utils/common/Command.h>
@@ -40,14 +42,13 @@
 // member definitions
 // ===========================================================================
 MSEventControl::MSEventControl()
-    : currentTimeStep(-1), myEvents() {}
+    : currentTimeStep(-1), myNextNumber(0), myEvents() {}
 
 
 MSEventControl::~MSEventControl() {
     // delete the events
     while (!myEvents.empty()) {
-        Event e = myEvents.top();
-        delete e.first;
+        delete myEvents.top().command;
         myEvents.pop();
     }
 }
@@ -55,7 +56,11 @@ MSEventControl::~MSEventControl() {
 
 void
 MSEventControl::addEvent(Command* operation, SUMOTime execTimeStep) {
-    myEvents.push(Event(operation, execTimeStep));
+    PendingEvent e;
+    e.command = operation;
+    e.number = myNextNumber++;
+    e.time = execTimeStep;
+    myEvents.push(e);
 }
 
 
@@ -63,12 +68,12 @@ void
 MSEventControl::execute(SUMOTime execTime) {
     // Execute all events that are scheduled for execTime.
     while (!myEvents.empty()) {
-        Event currEvent = myEvents.top();
-        if (currEvent.second < 0) {
-            currEvent.second = execTime;
+        PendingEvent currEvent = myEvents.top();
+        if (currEvent.time < 0) {
+            currEvent.time = execTime;
         }
-        if (currEvent.second < execTime + DELTA_T) {
-            Command* command = currEvent.first;
+        if (currEvent.time < execTime + DELTA_T) {
+            Command* command = currEvent.command;
             myEvents.pop();
             SUMOTime time = 0;
             try {
@@ -84,9 +89,9 @@ MSEventControl::execute(SUMOTime execTime) {
                 if (time < 0) {
                     WRITE_WARNING("Command returned negative repeat number; will be deleted.");
                 }
-                delete currEvent.first;
+                delete currEvent.command;
             } else {
-                currEvent.second += time;
+                currEvent.time += time;
                 myEvents.push(currEvent);
             }
         } else {
@@ -101,6 +106,42 @@ MSEventControl::isEmpty() {
     return myEvents.empty();
 }
 
+
+std::vector<MSEventControl::PendingEvent>
+MSEventControl::getEvents() const {
+    return myEvents.getHeap();
+}
+
+
+int
+MSEventControl::restoreEvents(const std::vector<PendingEvent>& events) {
+    std::vector<PendingEvent>& heap = myEvents.getHeap();
+    std::set<long long int> pending;
+    for (std::vector<PendingEvent>::const_iterator i = heap.begin(); i != heap.end(); ++i) {
+        pending.insert(i->number);
+    }
+    // keep the layout of the saved heap so that events with equal times keep their order
+    std::vector<PendingEvent> restored;
+    std::set<long long int> known;
+    for (std::vector<PendingEvent>::const_iterator i = events.begin(); i != events.end(); ++i) {
+        known.insert(i->number);
+        if (pending.count(i->number) > 0) {
+            restored.push_back(*i);
+        }
+    }
+    const int numLost = (int)events.size() - (int)restored.size();
+    for (std::vector<PendingEvent>::const_iterator i = heap.begin(); i != heap.end(); ++i) {
+        if (known.count(i->number) == 0) {
+            restored.push_back(*i);
+        }
+    }
+    if (numLost > 0 || restored.size() > events.size()) {
+        std::make_heap(restored.begin(), restored.end(), EventSortCrit());
+    }
+    heap.swap(restored);
+    return numLost;
+}
+
 void
 MSEventControl::setCurrentTimeStep(SUMOTime time) {
     currentTimeStep = time;
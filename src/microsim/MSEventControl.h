@@ -56,6 +56,16 @@ public:
     /// @brief Combination of an event and the time it shall be executed at
     typedef std::pair< Command*, SUMOTime > Event;
 
+    /// @brief A pending event as kept for restoring it (see getEvents)
+    struct PendingEvent {
+        /// @brief the command to execute
+        Command* command;
+        /// @brief the unique number the command got when it was added
+        long long int number;
+        /// @brief the execution time
+        SUMOTime time;
+    };
+
 
 public:
     /// @brief Default constructor.
@@ -102,6 +112,28 @@ public:
     bool isEmpty();
 
 
+    /** @brief Returns the pending events in the layout of the queue
+     *
+     * @return the pending events with their execution times
+     */
+    std::vector<PendingEvent> getEvents() const;
+
+
+    /** @brief Resets the execution times of the pending events to the given ones
+     *
+     * Events which are pending now and were pending when the given list was
+     *  retrieved get their old time back. If no events were added or removed
+     *  in between, the queue is restored exactly and events with equal times
+     *  are executed in the same order as before. Events which were added later
+     *  keep their time. Events from the list which have been executed for the
+     *  last time in between are gone and cannot be restored.
+     *
+     * @param[in] events The events as returned by getEvents
+     * @return The number of events which could not be restored
+     */
+    int restoreEvents(const std::vector<PendingEvent>& events);
+
+
     /** @brief Set the current Time.
      *
      * This method is only for Unit Testing.
@@ -111,27 +143,48 @@ public:
     void setCurrentTimeStep(SUMOTime time);
 
 
-protected:
-    /** @brief Sort-criterion for events.
+private:
+    /**
+     * @class EventSortCrit
+     * @brief Sort-criterion for events
      *
-     * Sorts events by their execution time
+     * Only the execution times are compared, so events with equal times are
+     *  executed in the order the heap yields them.
      */
     class EventSortCrit {
     public:
         /// @brief compares two events
-        bool operator()(const Event& e1, const Event& e2) const {
-            return e1.second > e2.second;
+        bool operator()(const PendingEvent& e1, const PendingEvent& e2) const {
+            return e1.time > e2.time;
         }
     };
 
 
-private:
-    /// @brief Container for time-dependant events, e.g. traffic-light-change.
-    typedef std::priority_queue< Event, std::vector< Event >, EventSortCrit > EventCont;
+    /**
+     * @class EventCont
+     * @brief Container for time-dependant events, e.g. traffic-light-change.
+     *
+     * Gives access to the heap for saving and restoring it.
+     */
+    class EventCont : public std::priority_queue< PendingEvent, std::vector< PendingEvent >, EventSortCrit > {
+    public:
+        /// @brief returns the events in the layout of the heap
+        std::vector< PendingEvent >& getHeap() {
+            return c;
+        }
+
+        /// @brief returns the events in the layout of the heap
+        const std::vector< PendingEvent >& getHeap() const {
+            return c;
+        }
+    };
 
     /// The current TimeStep
     SUMOTime currentTimeStep;
 
+    /// @brief The number for the next added event (distinguishes commands reusing the memory of deleted ones)
+    long long int myNextNumber;
+
     /// @brief Event-container, holds executable events.
     EventCont myEvents;
 
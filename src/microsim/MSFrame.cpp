@@ -84,6 +84,9 @@ MSFrame::fillOptions() {
     oc.addDescription("net-file", "Input", "Load road network description from FILE");
     oc.addXMLDefault("net-file", "net");
 
+    oc.doRegister("net-file.binary-cache", new Option_Bool(false));
+    oc.addDescription("net-file.binary-cache", "Input", "Load the network from a binary copy (.sbx) next to the net-file which is written on the first load");
+
     oc.doRegister("route-files", 'r', new Option_FileName());
     oc.addSynonyme("route-files", "routes");
     oc.addDescription("route-files", "Input", "Load routes descriptions from FILE(s)");
@@ -216,6 +219,9 @@ MSFrame::fillOptions() {
     oc.doRegister("stop-output", new Option_FileName());
     oc.addDescription("stop-output", "Output", "Record stops and loading/unloading of passenger and containers for all vehicles into FILE");
 
+    oc.doRegister("profiling-output", new Option_FileName());
+    oc.addDescription("profiling-output", "Output", "Save the computation time of the simulation phases, the throughput and the peak memory usage into FILE");
+
 #ifdef _DEBUG
     oc.doRegister("movereminder-output", new Option_FileName());
     oc.addDescription("movereminder-output", "Output", "Save movereminder states of selected vehicles into FILE");
@@ -233,6 +239,8 @@ MSFrame::fillOptions() {
     oc.addDescription("save-state.suffix", "Output", "Suffix for network states (.sbx or .xml)");
     oc.doRegister("save-state.files", new Option_FileName());//
     oc.addDescription("save-state.files", "Output", "Files for network states");
+    oc.doRegister("save-state.async", new Option_Bool(false));
+    oc.addDescription("save-state.async", "Output", "Write network states in a background thread");
 
     // register the simulation settings
     oc.doRegister("begin", 'b', new Option_String("0", "TIME"));
@@ -258,6 +266,9 @@ MSFrame::fillOptions() {
     oc.doRegister("route-steps", 's', new Option_String("200", "TIME"));
     oc.addDescription("route-steps", "Processing", "Load routes for the next number of seconds ahead");
 
+    oc.doRegister("route-loading.threaded", new Option_Bool(false));
+    oc.addDescription("route-loading.threaded", "Processing", "Parse each route file ahead of the simulation in a separate thread");
+
     oc.doRegister("no-internal-links", new Option_Bool(false));
     oc.addDescription("no-internal-links", "Processing", "Disable (junction) internal links");
 
@@ -340,6 +351,9 @@ MSFrame::fillOptions() {
     oc.doRegister("pedestrian.striping.jamtime", new Option_String("300", "TIME"));
     oc.addDescription("pedestrian.striping.jamtime", "Processing", "Time in seconds after which pedestrians start squeezing through a jam when using model 'striping' (non-positive values disable squeezing)");
 
+    oc.doRegister("pedestrian.striping.threads", new Option_Integer(0));
+    oc.addDescription("pedestrian.striping.threads", "Processing", "The number of threads for moving all lanes in parallel, each seeing the others at their state before the step, for use with model 'striping'");
+
     oc.doRegister("pedestrian.remote.address", new Option_String("localhost:9000"));
     oc.addDescription("pedestrian.remote.address", "Processing", "The address (host:port) of the external simulation");
 
@@ -426,6 +440,8 @@ MSFrame::fillOptions() {
     oc.addDescription("meso-overtaking", "Mesoscopic", "Enable mesoscopic overtaking");
     oc.doRegister("meso-recheck", new Option_String("0", "TIME"));
     oc.addDescription("meso-recheck", "Mesoscopic", "Time interval for rechecking insertion into the next segment after failure");
+    oc.doRegister("meso-threads", new Option_Integer(0));
+    oc.addDescription("meso-threads", "Mesoscopic", "The number of network regions to simulate in parallel");
 
     // add rand options
     RandHelper::insertRandOptions();
@@ -600,6 +616,28 @@ MSFrame::checkOptions() {
         WRITE_ERROR("Unknown model '" + oc.getString("carfollow.model")  + "' for option 'carfollow.model'.");
         ok = false;
     }
+#ifndef HAVE_FOX
+    if (oc.getBool("save-state.async")) {
+        WRITE_ERROR("Writing states in the background is only possible when compiled with Fox.");
+        ok = false;
+    }
+    if (oc.getInt("pedestrian.striping.threads") > 0) {
+        WRITE_ERROR("Parallel pedestrian movement is only possible when compiled with Fox.");
+        ok = false;
+    }
+    if (oc.getInt("meso-threads") > 0) {
+        WRITE_ERROR("Parallel mesoscopic simulation is only possible when compiled with Fox.");
+        ok = false;
+    }
+#endif
+    if (oc.getInt("meso-threads") < 0) {
+        WRITE_ERROR("The number of mesoscopic threads must not be negative.");
+        ok = false;
+    }
+    if (oc.getInt("meso-threads") > 0 && oc.getBool("meso-overtaking")) {
+        WRITE_WARNING("Mesoscopic overtaking is not supported with parallel simulation, using a single thread.");
+        oc.set("meso-threads", "0");
+    }
     ok &= MSDevice::checkOptions(oc);
     ok &= SystemFrame::checkOptions();
 
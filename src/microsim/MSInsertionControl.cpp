@@ -338,17 +338,46 @@ MSInsertionControl::adaptIntermodalRouter(MSNet::MSIntermodalRouter& router) con
 
 
 void
-MSInsertionControl::saveState(OutputDevice& out) {
+MSInsertionControl::saveState(OutputDevice& out, const bool snapshot) {
     // save flow states
     for (const Flow& flow : myFlows) {
         out.openTag(SUMO_TAG_FLOWSTATE);
         out.writeAttr(SUMO_ATTR_ID, flow.pars->id);
         out.writeAttr(SUMO_ATTR_INDEX, flow.index);
+        if (snapshot) {
+            // the number of repetitions done
+            out.writeAttr(SUMO_ATTR_NUMBER, flow.pars->repetitionsDone);
+        }
         out.closeTag();
     }
 }
 
 
+void
+MSInsertionControl::clearState() {
+    while (!myAllVeh.isEmpty()) {
+        myAllVeh.pop();
+    }
+    myPendingEmits.clear();
+    myEmitCandidates.clear();
+    myAbortedEmits.clear();
+    myPendingEmitsForLane.clear();
+}
+
+
+bool
+MSInsertionControl::restoreFlow(const std::string& id, const int index, const int repetitionsDone) {
+    for (Flow& flow : myFlows) {
+        if (flow.pars->id == id) {
+            flow.index = index;
+            flow.pars->repetitionsDone = repetitionsDone;
+            return true;
+        }
+    }
+    return false;
+}
+
+
 SUMOTime
 MSInsertionControl::computeRandomDepartOffset() const {
     if (myMaxRandomDepartOffset > 0) {
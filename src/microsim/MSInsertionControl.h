@@ -158,8 +158,26 @@ public:
     SUMOTime computeRandomDepartOffset() const;
 
     /** @brief Saves the current state into the given stream
+     *
+     * @param[in] out The device to write the state into
+     * @param[in] snapshot Whether the progress of the flows shall be written for restoring it in this simulation
+     */
+    void saveState(OutputDevice& out, const bool snapshot = false);
+
+    /** @brief Forgets all vehicles waiting for insertion
+     *
+     * Called when the simulation state is replaced, the vehicles are deleted by the vehicle control.
+     */
+    void clearState();
+
+    /** @brief Resets the progress of a flow when restoring a snapshot
+     *
+     * @param[in] id The id of the flow
+     * @param[in] index The index of the next vehicle of the flow
+     * @param[in] repetitionsDone The number of repetitions already done
+     * @return whether the flow is still known
      */
-    void saveState(OutputDevice& out);
+    bool restoreFlow(const std::string& id, const int index, const int repetitionsDone);
 
 private:
     /** @brief Tries to emit the vehicle
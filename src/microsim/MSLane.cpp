@@ -2783,6 +2783,24 @@ MSLane::saveState(OutputDevice& out) {
 }
 
 
+void
+MSLane::clearState() {
+    myVehicles.clear();
+    myPartialVehicles.clear();
+    myTmpVehicles.clear();
+    myVehBuffer.clear();
+    myManeuverReservations.clear();
+    myParkingVehicles.clear();
+    myBruttoVehicleLengthSum = 0;
+    myNettoVehicleLengthSum = 0;
+    myLeaderInfoTime = SUMOTime_MIN;
+    myFollowerInfoTime = SUMOTime_MIN;
+    for (std::vector<MSMoveReminder*>::iterator rem = myMoveReminders.begin(); rem != myMoveReminders.end(); ++rem) {
+        (*rem)->clearState();
+    }
+}
+
+
 void
 MSLane::loadState(std::vector<std::string>& vehIds, MSVehicleControl& vc) {
     for (std::vector<std::string>::const_iterator it = vehIds.begin(); it != vehIds.end(); ++it) {
@@ -1055,6 +1055,13 @@ public:
      * @todo What about throwing an error if something else fails (a vehicle can not be referenced)?
      */
     void loadState(std::vector<std::string>& vehIDs, MSVehicleControl& vc);
+
+    /** @brief Removes all vehicles from the lane without notifying them
+     *
+     * Called when the simulation state is replaced, after all vehicles were deleted.
+     *  The move reminders of the lane forget their vehicles as well.
+     */
+    void clearState();
     /// @}
 
 
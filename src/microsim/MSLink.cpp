@@ -316,9 +316,8 @@ MSLink::setApproaching(const SUMOVehicle* approaching, const SUMOTime arrivalTim
         }
     }
 #endif
-    myApproachingVehicles.insert(std::make_pair(approaching,
-                                 ApproachingVehicleInformation(arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, setRequest,
-                                         arrivalTimeBraking, arrivalSpeedBraking, waitingTime, dist)));
+    setApproaching(approaching, ApproachingVehicleInformation(arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, setRequest,
+                   arrivalTimeBraking, arrivalSpeedBraking, waitingTime, dist));
 }
 
 
@@ -333,7 +332,15 @@ MSLink::setApproaching(const SUMOVehicle* approaching, ApproachingVehicleInforma
         }
     }
 #endif
-    myApproachingVehicles.insert(std::make_pair(approaching, ai));
+    if (findApproaching(approaching) == myApproachingVehicles.end()) {
+        // keep the vehicles sorted by id as the iteration order influences the results
+        // (the numerical index depends on the insertion order and would differ after loading a saved state)
+        ApproachInfos::iterator i = std::lower_bound(myApproachingVehicles.begin(), myApproachingVehicles.end(), approaching,
+        [](const ApproachInfos::value_type & a, const SUMOVehicle * veh) {
+            return a.first->getID() < veh->getID();
+        });
+        myApproachingVehicles.insert(i, std::make_pair(approaching, ai));
+    }
 }
 
 
@@ -367,13 +374,36 @@ MSLink::removeApproaching(const SUMOVehicle* veh) {
         }
     }
 #endif
-    myApproachingVehicles.erase(veh);
+    ApproachInfos::iterator i = findApproaching(veh);
+    if (i != myApproachingVehicles.end()) {
+        myApproachingVehicles.erase(i);
+    }
+}
+
+
+MSLink::ApproachInfos::iterator
+MSLink::findApproaching(const SUMOVehicle* veh) {
+    ApproachInfos::iterator i = myApproachingVehicles.begin();
+    while (i != myApproachingVehicles.end() && i->first != veh) {
+        ++i;
+    }
+    return i;
+}
+
+
+MSLink::ApproachInfos::const_iterator
+MSLink::findApproaching(const SUMOVehicle* veh) const {
+    ApproachInfos::const_iterator i = myApproachingVehicles.begin();
+    while (i != myApproachingVehicles.end() && i->first != veh) {
+        ++i;
+    }
+    return i;
 }
 
 
 MSLink::ApproachingVehicleInformation
 MSLink::getApproaching(const SUMOVehicle* veh) const {
-    std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = myApproachingVehicles.find(veh);
+    ApproachInfos::const_iterator i = findApproaching(veh);
     if (i != myApproachingVehicles.end()) {
         return i->second;
     } else {
@@ -405,7 +435,7 @@ MSLink::opened(SUMOTime arrivalTime, double arrivalSpeed, double leaveSpeed, dou
         for (std::vector<MSLink*>::const_iterator it = mySublaneFoeLinks.begin(); it != mySublaneFoeLinks.end(); ++it) {
             const MSLink* foeLink = *it;
             assert(myLane != foeLink->getLane());
-            for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = foeLink->myApproachingVehicles.begin(); i != foeLink->myApproachingVehicles.end(); ++i) {
+            for (ApproachInfos::const_iterator i = foeLink->myApproachingVehicles.begin(); i != foeLink->myApproachingVehicles.end(); ++i) {
                 const SUMOVehicle* foe = i->first;
                 if (
                     // there only is a conflict if the paths cross
@@ -476,7 +506,7 @@ bool
 MSLink::blockedAtTime(SUMOTime arrivalTime, SUMOTime leaveTime, double arrivalSpeed, double leaveSpeed,
                       bool sameTargetLane, double impatience, double decel, SUMOTime waitingTime,
                       std::vector<const SUMOVehicle*>* collectFoes, const SUMOVehicle* ego) const {
-    for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = myApproachingVehicles.begin(); i != myApproachingVehicles.end(); ++i) {
+    for (ApproachInfos::const_iterator i = myApproachingVehicles.begin(); i != myApproachingVehicles.end(); ++i) {
 #ifdef MSLink_DEBUG_OPENED
         if (gDebugFlag1) {
             if (ego != 0
@@ -669,16 +699,20 @@ MSLink::writeApproaching(OutputDevice& od, const std::string fromLaneID) const {
         const std::string via = getViaLane() == 0 ? "" : getViaLane()->getID();
         od.writeAttr(SUMO_ATTR_VIA, via);
         od.writeAttr(SUMO_ATTR_TO, getLane() == 0 ? "" : getLane()->getID());
-        std::vector<std::pair<SUMOTime, const SUMOVehicle*> > toSort; // stabilize output
-        for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator it = myApproachingVehicles.begin(); it != myApproachingVehicles.end(); ++it) {
-            toSort.push_back(std::make_pair(it->second.arrivalTime, it->first));
+        std::vector<std::pair<SUMOTime, const ApproachInfos::value_type*> > toSort; // stabilize output
+        for (ApproachInfos::const_iterator it = myApproachingVehicles.begin(); it != myApproachingVehicles.end(); ++it) {
+            toSort.push_back(std::make_pair(it->second.arrivalTime, &(*it)));
         }
-        std::sort(toSort.begin(), toSort.end());
-        for (std::vector<std::pair<SUMOTime, const SUMOVehicle*> >::const_iterator it = toSort.begin(); it != toSort.end(); ++it) {
+        // the approaching vehicles are sorted by id already, a stable sort keeps this order for equal times
+        std::stable_sort(toSort.begin(), toSort.end(), [](const std::pair<SUMOTime, const ApproachInfos::value_type*>& a, const std::pair<SUMOTime, const ApproachInfos::value_type*>& b) {
+            return a.first < b.first;
+        });
+        for (std::vector<std::pair<SUMOTime, const ApproachInfos::value_type*> >::const_iterator it = toSort.begin(); it != toSort.end(); ++it) {
             od.openTag("approaching");
-            const ApproachingVehicleInformation& avi = myApproachingVehicles.find(it->second)->second;
-            od.writeAttr(SUMO_ATTR_ID, it->second->getID());
-            od.writeAttr(SUMO_ATTR_IMPATIENCE, it->second->getImpatience());
+            const SUMOVehicle* veh = it->second->first;
+            const ApproachingVehicleInformation& avi = it->second->second;
+            od.writeAttr(SUMO_ATTR_ID, veh->getID());
+            od.writeAttr(SUMO_ATTR_IMPATIENCE, veh->getImpatience());
             od.writeAttr("arrivalTime", time2string(avi.arrivalTime));
             od.writeAttr("arrivalTimeBraking", time2string(avi.arrivalTimeBraking));
             od.writeAttr("leaveTime", time2string(avi.leavingTime));
@@ -118,30 +118,34 @@ public:
         }
 
         /// @brief The time the vehicle's front arrives at the link
-        const SUMOTime arrivalTime;
+        SUMOTime arrivalTime;
         /// @brief The estimated time at which the vehicle leaves the link
-        const SUMOTime leavingTime;
+        SUMOTime leavingTime;
         /// @brief The estimated speed with which the vehicle arrives at the link (for headway computation)
-        const double arrivalSpeed;
+        double arrivalSpeed;
         /// @brief The estimated speed with which the vehicle leaves the link (for headway computation)
-        const double leaveSpeed;
+        double leaveSpeed;
         /// @brief Whether the vehicle wants to pass the link (@todo: check semantics)
-        const bool willPass;
+        bool willPass;
         /// @brief The time the vehicle's front arrives at the link if it starts braking
-        const SUMOTime arrivalTimeBraking;
+        SUMOTime arrivalTimeBraking;
         /// @brief The estimated speed with which the vehicle arrives at the link if it starts braking(for headway computation)
-        const double arrivalSpeedBraking;
+        double arrivalSpeedBraking;
         /// @brief The waiting duration at the current link
-        const SUMOTime waitingTime;
+        SUMOTime waitingTime;
         /// @brief The distance up to the current link
-        const double dist;
-
-    private:
-        /// invalidated assignment operator
-        ApproachingVehicleInformation& operator=(const ApproachingVehicleInformation& s);
+        double dist;
 
     };
 
+    /** @brief The container of approaching vehicles
+     *
+     * A flat vector sorted by the vehicle ids (the iteration order of the former
+     *  map). Links are approached by a few vehicles only, so lookups by pointer
+     *  are faster than the id comparisons of a tree.
+     */
+    typedef std::vector<std::pair<const SUMOVehicle*, ApproachingVehicleInformation> > ApproachInfos;
+
 
     /** @brief Constructor for simulation which uses internal lanes
      *
@@ -194,6 +198,15 @@ public:
     /// @brief removes the vehicle from myApproachingVehicles
     void removeApproaching(const SUMOVehicle* veh);
 
+private:
+    /// @brief returns the position of the vehicle in myApproachingVehicles (end() if it is not approaching)
+    ApproachInfos::iterator findApproaching(const SUMOVehicle* veh);
+
+    /// @brief returns the position of the vehicle in myApproachingVehicles (end() if it is not approaching)
+    ApproachInfos::const_iterator findApproaching(const SUMOVehicle* veh) const;
+
+public:
+
     void addBlockedLink(MSLink* link);
 
     /* @brief return information about this vehicle if it is registered as
@@ -202,7 +215,7 @@ public:
     ApproachingVehicleInformation getApproaching(const SUMOVehicle* veh) const;
 
     /// @brief return all approaching vehicles
-    const std::map<const SUMOVehicle*, ApproachingVehicleInformation, SUMOVehicle::ComparatorIdLess>& getApproaching() const {
+    const ApproachInfos& getApproaching() const {
         return myApproachingVehicles;
     }
 
@@ -542,7 +555,8 @@ private:
     /// @brief The lane approaching this link
     MSLane* myLaneBefore;
 
-    std::map<const SUMOVehicle*, ApproachingVehicleInformation, SUMOVehicle::ComparatorIdLess> myApproachingVehicles;
+    /// @brief The vehicles approaching this link, sorted by their ids
+    ApproachInfos myApproachingVehicles;
     std::set<MSLink*> myBlockedFoeLinks;
 
     /// @brief The position within this respond
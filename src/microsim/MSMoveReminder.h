@@ -184,6 +184,25 @@ public:
     }
 
 
+    /** @brief Forgets all vehicles the reminder is currently tracking
+     *
+     * Called when the simulation state is replaced and all vehicles are deleted.
+     *  The reminders will be notified about the vehicles of the restored state.
+     */
+    virtual void clearState() {}
+
+
+    /** @brief Returns whether the notifications only modify this reminder and the notifying vehicle
+     *
+     * This holds for devices which do not share data with other vehicles. The
+     *  mesoscopic simulation notifies such reminders from parallel regions.
+     * @return Whether the reminder may be notified concurrently for different vehicles
+     */
+    virtual bool isVehicleLocal() const {
+        return false;
+    }
+
+
     // TODO: Documentation
     void updateDetector(SUMOVehicle& veh, double entryPos, double leavePos,
                         SUMOTime entryTime, SUMOTime currentTime, SUMOTime leaveTime,
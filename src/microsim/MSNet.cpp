@@ -189,6 +189,10 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myMaxTeleports = oc.getInt("max-num-teleports");
     myLogExecutionTime = !oc.getBool("no-duration-log");
     myLogStepNumber = !oc.getBool("no-step-log");
+    myProfileSteps = oc.isSet("profiling-output");
+    myPhaseDurations.resize(PHASE_NUMBER, 0);
+    myPhaseStart = 0;
+    myPersonsMoved = 0;
     myInserter = new MSInsertionControl(*vc, string2time(oc.getString("max-depart-delay")), oc.getBool("eager-insert"), oc.getInt("max-num-vehicles"), 
             string2time(oc.getString("random-depart-offset")));
     myVehicleControl = vc;
@@ -208,7 +212,7 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myLanesRTree.first = false;
 
     if (MSGlobals::gUseMesoSim) {
-        MSGlobals::gMesoNet = new MELoop(string2time(oc.getString("meso-recheck")));
+        MSGlobals::gMesoNet = new MELoop(string2time(oc.getString("meso-recheck")), oc.getInt("meso-threads"));
     }
     myInstance = this;
 }
@@ -234,6 +238,7 @@ MSNet::closeBuilding(const OptionsCont& oc, MSEdgeControl* edges, MSJunctionCont
     myStateDumpPeriod = string2time(oc.getString("save-state.period"));
     myStateDumpPrefix = oc.getString("save-state.prefix");
     myStateDumpSuffix = oc.getString("save-state.suffix");
+    myStateDumpAsync = oc.getBool("save-state.async");
 
     // set requests/responses
     myJunctions->postloadInitContainer();
@@ -253,6 +258,8 @@ MSNet::closeBuilding(const OptionsCont& oc, MSEdgeControl* edges, MSJunctionCont
 
 
 MSNet::~MSNet() {
+    // finish writing states
+    MSStateHandler::cleanup();
     // delete controls
     delete myJunctions;
     delete myDetectorControl;
@@ -364,6 +371,8 @@ MSNet::loadRoutes() {
 
 void
 MSNet::closeSimulation(SUMOTime start) {
+    // report errors of states written in the background
+    MSStateHandler::waitForAll();
     myDetectorControl->close(myStep);
     if (OptionsCont::getOptions().getBool("vehroute-output.write-unfinished")) {
         MSDevice_Vehroutes::generateOutputForUnfinished();
@@ -374,6 +383,9 @@ MSNet::closeSimulation(SUMOTime start) {
     if (OptionsCont::getOptions().isSet("chargingstations-output")) {
         writeChargingStationOutput();
     }
+    if (myProfileSteps) {
+        writeProfilingOutput(start);
+    }
     if (myLogExecutionTime) {
         long duration = SysUtils::getCurrentMillis() - mySimBeginMillis;
         std::ostringstream msg;
@@ -429,6 +441,38 @@ MSNet::closeSimulation(SUMOTime start) {
 }
 
 
+void
+MSNet::writeProfilingOutput(SUMOTime start) const {
+    static const char* const phaseNames[PHASE_NUMBER] = {
+        "traci", "events", "tls", "meso", "planMovements", "executeMovements", "laneChange",
+        "routeLoading", "transportables", "insertion", "endEvents", "output"
+    };
+    long long int total = 0;
+    for (const long long int duration : myPhaseDurations) {
+        total += duration;
+    }
+    const long long int steps = (myStep - start) / DELTA_T;
+    OutputDevice& od = OutputDevice::getDeviceByOption("profiling-output");
+    od.writeXMLHeader("profiling", "");
+    od.openTag("simulation");
+    od.writeAttr("steps", steps);
+    od.writeAttr("vehicleSteps", myVehiclesMoved);
+    od.writeAttr("duration", total / 1000.);
+    od.writeAttr("vehicleStepsPerSecond", total > 0 ? (double)myVehiclesMoved * 1e6 / (double)total : 0.);
+    od.writeAttr("personSteps", myPersonsMoved);
+    od.writeAttr("peakMemory", SysUtils::getPeakMemoryUsage());
+    od.closeTag();
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        od.openTag("phase");
+        od.writeAttr("name", phaseNames[i]);
+        od.writeAttr("duration", myPhaseDurations[i] / 1000.);
+        od.writeAttr("perStep", steps > 0 ? (double)myPhaseDurations[i] / 1000. / (double)steps : 0.);
+        od.writeAttr("share", total > 0 ? (double)myPhaseDurations[i] / (double)total : 0.);
+        od.closeTag();
+    }
+}
+
+
 void
 MSNet::simulationStep() {
 #ifdef DEBUG_SIMSTEP
@@ -436,6 +480,9 @@ MSNet::simulationStep() {
               << ", myStep = " << myStep
               << std::endl;
 #endif
+    if (myProfileSteps) {
+        myPhaseStart = SysUtils::getCurrentMicros();
+    }
     if (myLogExecutionTime) {
         myTraCIStepDuration = SysUtils::getCurrentMillis();
     }
@@ -451,6 +498,7 @@ MSNet::simulationStep() {
     if (myLogExecutionTime) {
         myTraCIStepDuration = SysUtils::getCurrentMillis() - myTraCIStepDuration;
     }
+    profilePhase(PHASE_TRACI);
 #ifdef DEBUG_SIMSTEP
     std::cout << SIMTIME << ": TraCI target time: " << t->getTargetTime() << std::endl;
 #endif
@@ -462,10 +510,10 @@ MSNet::simulationStep() {
     std::vector<SUMOTime>::iterator timeIt = find(myStateDumpTimes.begin(), myStateDumpTimes.end(), myStep);
     if (timeIt != myStateDumpTimes.end()) {
         const int dist = (int)distance(myStateDumpTimes.begin(), timeIt);
-        MSStateHandler::saveState(myStateDumpFiles[dist], myStep);
+        MSStateHandler::saveState(myStateDumpFiles[dist], myStep, myStateDumpAsync);
     }
     if (myStateDumpPeriod > 0 && myStep % myStateDumpPeriod == 0) {
-        MSStateHandler::saveState(myStateDumpPrefix + "_" + time2string(myStep) + myStateDumpSuffix, myStep);
+        MSStateHandler::saveState(myStateDumpPrefix + "_" + time2string(myStep) + myStateDumpSuffix, myStep, myStateDumpAsync);
     }
     myBeginOfTimestepEvents->execute(myStep);
 #ifdef HAVE_FOX
@@ -474,11 +522,14 @@ MSNet::simulationStep() {
     if (MSGlobals::gCheck4Accidents) {
         myEdges->detectCollisions(myStep, STAGE_EVENTS);
     }
+    profilePhase(PHASE_EVENTS);
     // check whether the tls programs need to be switched
     myLogics->check2Switch(myStep);
+    profilePhase(PHASE_TLS);
 
     if (MSGlobals::gUseMesoSim) {
         MSGlobals::gMesoNet->simulate(myStep);
+        profilePhase(PHASE_MESO);
     } else {
         // assure all lanes with vehicles are 'active'
         myEdges->patchActiveLanes();
@@ -486,12 +537,14 @@ MSNet::simulationStep() {
         // compute safe velocities for all vehicles for the next few lanes
         // also register ApproachingVehicleInformation for all links
         myEdges->planMovements(myStep);
+        profilePhase(PHASE_PLAN_MOVEMENTS);
 
         // decide right-of-way and execute movements
         myEdges->executeMovements(myStep);
         if (MSGlobals::gCheck4Accidents) {
             myEdges->detectCollisions(myStep, STAGE_MOVEMENTS);
         }
+        profilePhase(PHASE_EXECUTE_MOVEMENTS);
 
         // vehicles may change lanes
         myEdges->changeLanes(myStep);
@@ -499,8 +552,10 @@ MSNet::simulationStep() {
         if (MSGlobals::gCheck4Accidents) {
             myEdges->detectCollisions(myStep, STAGE_LANECHANGE);
         }
+        profilePhase(PHASE_LANE_CHANGE);
     }
     loadRoutes();
+    profilePhase(PHASE_ROUTE_LOADING);
 
     // persons
     if (myPersonControl != 0 && myPersonControl->hasTransportables()) {
@@ -510,6 +565,7 @@ MSNet::simulationStep() {
     if (myContainerControl != 0 && myContainerControl->hasTransportables()) {
         myContainerControl->checkWaiting(this, myStep);
     }
+    profilePhase(PHASE_TRANSPORTABLES);
     // insert vehicles
     myInserter->determineCandidates(myStep);
     myInsertionEvents->execute(myStep);
@@ -522,9 +578,11 @@ MSNet::simulationStep() {
         myEdges->detectCollisions(myStep, STAGE_INSERTIONS);
     }
     MSVehicleTransfer::getInstance()->checkInsertions(myStep);
+    profilePhase(PHASE_INSERTION);
 
     // execute endOfTimestepEvents
     myEndOfTimestepEvents->execute(myStep);
+    profilePhase(PHASE_END_EVENTS);
 
     if (TraCIServer::getInstance() != 0) {
         if (myLogExecutionTime) {
@@ -534,14 +592,21 @@ MSNet::simulationStep() {
         if (myLogExecutionTime) {
             myTraCIStepDuration += SysUtils::getCurrentMillis();
         }
+        profilePhase(PHASE_TRACI);
     }
     // update and write (if needed) detector values
     writeOutput();
+    profilePhase(PHASE_OUTPUT);
 
     if (myLogExecutionTime) {
         mySimStepDuration = SysUtils::getCurrentMillis() - mySimStepDuration;
+    }
+    if (myLogExecutionTime || myProfileSteps) {
         myVehiclesMoved += myVehicleControl->getRunningVehicleNo();
     }
+    if (myProfileSteps && myPersonControl != 0) {
+        myPersonsMoved += myPersonControl->getRunningNumber();
+    }
     myStep += DELTA_T;
 }
 
@@ -622,6 +687,35 @@ MSNet::clearAll() {
         t->cleanup();
     }
     libsumo::Helper::cleanup();
+    libsumo::Simulation::cleanup();
+}
+
+
+void
+MSNet::clearState() {
+    if (MSGlobals::gUseMesoSim) {
+        throw ProcessError("Restoring the simulation state is not supported for the mesoscopic simulation.");
+    }
+    if ((hasPersons() && myPersonControl->getLoadedNumber() > 0) || (hasContainers() && myContainerControl->getLoadedNumber() > 0)) {
+        throw ProcessError("Restoring the simulation state is not supported for simulations with persons or containers.");
+    }
+    // the vehicles remove themselves from the lanes and links on deletion
+    myVehicleControl->clearState();
+    for (MSEdge* const edge : MSEdge::getAllEdges()) {
+        for (MSLane* const lane : edge->getLanes()) {
+            lane->clearState();
+        }
+    }
+    myInserter->clearState();
+    MSVehicleTransfer::getInstance()->clearState();
+    for (auto& category : myStoppingPlaces) {
+        for (const auto& it : category.second) {
+            it.second->clearState();
+        }
+    }
+    if (MSStopOut::active()) {
+        MSStopOut::getInstance()->clearState();
+    }
 }
 
 
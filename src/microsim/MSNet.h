@@ -45,6 +45,7 @@
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/NamedObjectCont.h>
 #include <utils/common/NamedRTree.h>
+#include <utils/common/SysUtils.h>
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <microsim/trigger/MSChargingStation.h>
 #include "MSJunction.h"
@@ -201,6 +202,16 @@ public:
     static void clearAll();
 
 
+    /** @brief Removes all vehicles and their traces from the network
+     *
+     * Used before restoring a snapshot of the simulation state. Afterwards the
+     *  simulation is in the state of an empty network, the flows and the
+     *  vehicles not loaded yet are kept.
+     * @exception ProcessError If the state cannot be cleared (mesoscopic simulation or persons)
+     */
+    void clearState();
+
+
     /** @brief Simulates from timestep start to stop
      * @param[in] start The begin time step of the simulation
      * @param[in] stop The end time step of the simulation
@@ -611,6 +622,35 @@ protected:
     /// @brief check all lanes for elevation data
     bool checkElevation();
 
+    /// @brief the phases of a simulation step distinguished by the profiling output
+    enum StepPhase {
+        PHASE_TRACI,
+        PHASE_EVENTS,
+        PHASE_TLS,
+        PHASE_MESO,
+        PHASE_PLAN_MOVEMENTS,
+        PHASE_EXECUTE_MOVEMENTS,
+        PHASE_LANE_CHANGE,
+        PHASE_ROUTE_LOADING,
+        PHASE_TRANSPORTABLES,
+        PHASE_INSERTION,
+        PHASE_END_EVENTS,
+        PHASE_OUTPUT,
+        PHASE_NUMBER
+    };
+
+    /// @brief adds the time since the end of the previous phase to the given phase (if profiling)
+    inline void profilePhase(const StepPhase phase) {
+        if (myProfileSteps) {
+            const long long int now = SysUtils::getCurrentMicros();
+            myPhaseDurations[phase] += now - myPhaseStart;
+            myPhaseStart = now;
+        }
+    }
+
+    /// @brief writes the accumulated phase durations, the throughput and the peak memory usage
+    void writeProfilingOutput(SUMOTime start) const;
+
 
 protected:
     /// @brief Unique instance of MSNet
@@ -677,6 +717,18 @@ protected:
 
     /// @brief The overall number of vehicle movements
     long long int myVehiclesMoved;
+
+    /// @brief Information whether the phases of the simulation steps shall be timed
+    bool myProfileSteps;
+
+    /// @brief The accumulated durations of the step phases in microseconds
+    std::vector<long long int> myPhaseDurations;
+
+    /// @brief The end of the last profiled phase
+    long long int myPhaseStart;
+
+    /// @brief The overall number of person movements (if profiling)
+    long long int myPersonsMoved;
     //}
 
 
@@ -693,6 +745,8 @@ protected:
     /// @brief name components for periodic state
     std::string myStateDumpPrefix;
     std::string myStateDumpSuffix;
+    /// @brief Whether states are written in the background
+    bool myStateDumpAsync;
     /// @}
 
 
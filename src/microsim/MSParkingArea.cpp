@@ -172,6 +172,16 @@ MSParkingArea::leaveFrom(SUMOVehicle* what) {
 }
 
 
+void
+MSParkingArea::clearState() {
+    for (std::map<unsigned int, LotSpaceDefinition >::iterator i = mySpaceOccupancies.begin(); i != mySpaceOccupancies.end(); i++) {
+        (*i).second.vehicle = 0;
+    }
+    myEndPositions.clear();
+    computeLastFreePos();
+}
+
+
 void
 MSParkingArea::computeLastFreePos() {
     myLastFreeLot = 0;
@@ -125,6 +125,11 @@ public:
     void leaveFrom(SUMOVehicle* what);
 
 
+    /** @brief Forgets all parked vehicles (called when the simulation state is replaced)
+     */
+    void clearState();
+
+
     /** @brief Returns the last free position on this stop
      *
      * @return The last free position of this bus stop
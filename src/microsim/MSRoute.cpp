@@ -45,6 +45,7 @@
 // ===========================================================================
 MSRoute::RouteDict MSRoute::myDict;
 MSRoute::RouteDistDict MSRoute::myDistDict;
+std::unordered_multimap<size_t, std::weak_ptr<const ConstMSEdgeVector> > MSRoute::myEdgesPool;
 #ifdef HAVE_FOX
 FXMutex MSRoute::myDictMutex(true);
 #endif
@@ -57,7 +58,7 @@ MSRoute::MSRoute(const std::string& id,
                  const ConstMSEdgeVector& edges,
                  const bool isPermanent, const RGBColor* const c,
                  const std::vector<SUMOVehicleParameter::Stop>& stops)
-    : Named(id), myEdges(edges), myAmPermanent(isPermanent),
+    : Named(id), myEdges(intern(edges)), myAmPermanent(isPermanent),
       myReferenceCounter(isPermanent ? 1 : 0),
       myColor(c), myStops(stops) {}
 
@@ -67,28 +68,80 @@ MSRoute::~MSRoute() {
 }
 
 
+std::shared_ptr<const ConstMSEdgeVector>
+MSRoute::intern(const ConstMSEdgeVector& edges) {
+    const size_t hash = hashEdges(edges);
+#ifdef HAVE_FOX
+    FXMutexLock f(myDictMutex);
+#endif
+    auto range = myEdgesPool.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        std::shared_ptr<const ConstMSEdgeVector> shared = it->second.lock();
+        if (shared != nullptr && *shared == edges) {
+            return shared;
+        }
+    }
+    // the deleter must not look at the edges, they may be gone already when the last route is deleted
+    std::shared_ptr<const ConstMSEdgeVector> shared(new ConstMSEdgeVector(edges), [hash](const ConstMSEdgeVector * e) {
+        releaseEdges(e, hash);
+    });
+    myEdgesPool.insert(std::make_pair(hash, std::weak_ptr<const ConstMSEdgeVector>(shared)));
+    return shared;
+}
+
+
+void
+MSRoute::releaseEdges(const ConstMSEdgeVector* edges, const size_t hash) {
+    {
+#ifdef HAVE_FOX
+        FXMutexLock f(myDictMutex);
+#endif
+        // the entry of the edges to delete is expired already, remove it (and other expired ones with the same hash)
+        auto range = myEdgesPool.equal_range(hash);
+        for (auto it = range.first; it != range.second;) {
+            if (it->second.expired()) {
+                it = myEdgesPool.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    delete edges;
+}
+
+
+size_t
+MSRoute::hashEdges(const ConstMSEdgeVector& edges) {
+    size_t hash = edges.size();
+    for (const MSEdge* const e : edges) {
+        hash = hash * 31 + e->getNumericalID();
+    }
+    return hash;
+}
+
+
 MSRouteIterator
 MSRoute::begin() const {
-    return myEdges.begin();
+    return myEdges->begin();
 }
 
 
 MSRouteIterator
 MSRoute::end() const {
-    return myEdges.end();
+    return myEdges->end();
 }
 
 
 int
 MSRoute::size() const {
-    return (int)myEdges.size();
+    return (int)myEdges->size();
 }
 
 
 const MSEdge*
 MSRoute::getLastEdge() const {
-    assert(myEdges.size() > 0);
-    return myEdges[myEdges.size() - 1];
+    assert(myEdges->size() > 0);
+    return myEdges->back();
 }
 
 
@@ -206,29 +259,34 @@ MSRoute::insertIDs(std::vector<std::string>& into) {
     FXMutexLock f(myDictMutex);
 #endif
     into.reserve(myDict.size() + myDistDict.size() + into.size());
+    // the dictionaries are unordered, sort to keep the output deterministic
+    const int numPrior = (int)into.size();
     for (RouteDict::const_iterator i = myDict.begin(); i != myDict.end(); ++i) {
         into.push_back((*i).first);
     }
+    std::sort(into.begin() + numPrior, into.end());
+    const int numRoutes = (int)into.size();
     for (RouteDistDict::const_iterator i = myDistDict.begin(); i != myDistDict.end(); ++i) {
         into.push_back((*i).first);
     }
+    std::sort(into.begin() + numRoutes, into.end());
 }
 
 
 int
 MSRoute::writeEdgeIDs(OutputDevice& os, const MSEdge* const from, const MSEdge* const upTo) const {
     int numWritten = 0;
-    ConstMSEdgeVector::const_iterator i = myEdges.begin();
+    ConstMSEdgeVector::const_iterator i = myEdges->begin();
     if (from != 0) {
-        i = std::find(myEdges.begin(), myEdges.end(), from);
+        i = std::find(myEdges->begin(), myEdges->end(), from);
     }
-    for (; i != myEdges.end(); ++i) {
+    for (; i != myEdges->end(); ++i) {
         if ((*i) == upTo) {
             return numWritten;
         }
         os << (*i)->getID();
         numWritten++;
-        if (upTo || i != myEdges.end() - 1) {
+        if (upTo || i != myEdges->end() - 1) {
             os << ' ';
         }
     }
@@ -250,7 +308,7 @@ MSRoute::containsAnyOf(const MSEdgeVector& edgelist) const {
 
 const MSEdge*
 MSRoute::operator[](int index) const {
-    return myEdges[index];
+    return (*myEdges)[index];
 }
 
 
@@ -259,12 +317,15 @@ MSRoute::dict_saveState(OutputDevice& out) {
 #ifdef HAVE_FOX
     FXMutexLock f(myDictMutex);
 #endif
-    for (RouteDict::iterator it = myDict.begin(); it != myDict.end(); ++it) {
+    // the dictionaries are unordered, sort to keep the output deterministic
+    const std::map<std::string, const MSRoute*> sortedDict(myDict.begin(), myDict.end());
+    for (std::map<std::string, const MSRoute*>::const_iterator it = sortedDict.begin(); it != sortedDict.end(); ++it) {
         out.openTag(SUMO_TAG_ROUTE).writeAttr(SUMO_ATTR_ID, (*it).second->getID());
         out.writeAttr(SUMO_ATTR_STATE, (*it).second->myAmPermanent);
-        out.writeAttr(SUMO_ATTR_EDGES, (*it).second->myEdges).closeTag();
+        out.writeAttr(SUMO_ATTR_EDGES, *(*it).second->myEdges).closeTag();
     }
-    for (RouteDistDict::iterator it = myDistDict.begin(); it != myDistDict.end(); ++it) {
+    const std::map<std::string, std::pair<RandomDistributor<const MSRoute*>*, bool> > sortedDistDict(myDistDict.begin(), myDistDict.end());
+    for (auto it = sortedDistDict.begin(); it != sortedDistDict.end(); ++it) {
         out.openTag(SUMO_TAG_ROUTE_DISTRIBUTION).writeAttr(SUMO_ATTR_ID, (*it).first);
         out.writeAttr(SUMO_ATTR_STATE, (*it).second.second);
         out.writeAttr(SUMO_ATTR_ROUTES, (*it).second.first->getVals());
@@ -280,7 +341,7 @@ MSRoute::getDistanceBetween(double fromPos, double toPos,
     /// XXX routes that start and end within the same intersection are not supported
     //std::cout << SIMTIME << " getDistanceBetween from=" << fromEdge->getID() << " to=" << toEdge->getID() << " fromPos=" << fromPos << " toPos=" << toPos << " includeInternal=" << includeInternal << "\n";
     if (fromEdge->isInternal()) {
-        if (fromEdge == myEdges.front()) {
+        if (fromEdge == myEdges->front()) {
             const MSEdge* succ = fromEdge->getSuccessors().front();
             assert(succ != 0);
             //std::cout << "  recurse fromSucc=" << succ->getID() << "\n";
@@ -298,17 +359,17 @@ MSRoute::getDistanceBetween(double fromPos, double toPos,
         //std::cout << "  recurse toPred=" << pred->getID() << "\n";
         return toPos + getDistanceBetween(fromPos, pred->getLength(), fromEdge, pred, includeInternal);
     }
-    ConstMSEdgeVector::const_iterator it = std::find(myEdges.begin(), myEdges.end(), fromEdge);
-    if (it == myEdges.end() || std::find(it, myEdges.end(), toEdge) == myEdges.end()) {
+    ConstMSEdgeVector::const_iterator it = std::find(myEdges->begin(), myEdges->end(), fromEdge);
+    if (it == myEdges->end() || std::find(it, myEdges->end(), toEdge) == myEdges->end()) {
         // start or destination not contained in route
         return std::numeric_limits<double>::max();
     }
-    ConstMSEdgeVector::const_iterator it2 = std::find(it + 1, myEdges.end(), toEdge);
+    ConstMSEdgeVector::const_iterator it2 = std::find(it + 1, myEdges->end(), toEdge);
 
     if (fromEdge == toEdge) {
         if (fromPos <= toPos) {
             return toPos - fromPos;
-        } else if (it2 == myEdges.end()) {
+        } else if (it2 == myEdges->end()) {
             // we don't visit the edge again
             return std::numeric_limits<double>::max();
         }
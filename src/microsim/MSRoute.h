@@ -34,7 +34,9 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <memory>
 #include <algorithm>
+#include <unordered_map>
 #include <utils/common/Named.h>
 #include <utils/distribution/RandomDistributor.h>
 #include <utils/common/RGBColor.h>
@@ -105,7 +107,7 @@ public:
     int writeEdgeIDs(OutputDevice& os, const MSEdge* const from, const MSEdge* const upTo = 0) const;
 
     bool contains(const MSEdge* const edge) const {
-        return std::find(myEdges.begin(), myEdges.end(), edge) != myEdges.end();
+        return std::find(myEdges->begin(), myEdges->end(), edge) != myEdges->end();
     }
 
     bool containsAnyOf(const MSEdgeVector& edgelist) const;
@@ -123,7 +125,7 @@ public:
     /// @}
 
     const ConstMSEdgeVector& getEdges() const {
-        return myEdges;
+        return *myEdges;
     }
 
     /** @brief Compute the distance between 2 given edges on this route, including the length of internal lanes.
@@ -227,8 +229,29 @@ public:
     static void insertIDs(std::vector<std::string>& into);
 
 private:
-    /// The list of edges to pass
-    ConstMSEdgeVector myEdges;
+    /** @brief Returns the shared immutable copy of the given edge sequence
+     *
+     * Routes with identical edges share a single edge vector which is
+     *  deleted (and removed from the pool) together with the last route using it.
+     *
+     * @param[in] edges The edges of the route
+     * @return the shared edge vector
+     */
+    static std::shared_ptr<const ConstMSEdgeVector> intern(const ConstMSEdgeVector& edges);
+
+    /** @brief removes the edge vector from the pool and deletes it (deleter of the shared pointers)
+     *
+     * @param[in] edges The edge vector to delete
+     * @param[in] hash The hash the edge vector was pooled with (computed on creation)
+     */
+    static void releaseEdges(const ConstMSEdgeVector* edges, const size_t hash);
+
+    /// @brief computes the hash of an edge sequence from the numerical edge ids
+    static size_t hashEdges(const ConstMSEdgeVector& edges);
+
+private:
+    /// The list of edges to pass (shared with all routes having the same edges)
+    std::shared_ptr<const ConstMSEdgeVector> myEdges;
 
     /// whether the route may be deleted after the last vehicle abandoned it
     const bool myAmPermanent;
@@ -247,17 +270,20 @@ private:
 
 private:
     /// Definition of the dictionary container
-    typedef std::map<std::string, const MSRoute*> RouteDict;
+    typedef std::unordered_map<std::string, const MSRoute*> RouteDict;
 
     /// The dictionary container
     static RouteDict myDict;
 
     /// Definition of the dictionary container
-    typedef std::map<std::string, std::pair<RandomDistributor<const MSRoute*>*, bool> > RouteDistDict;
+    typedef std::unordered_map<std::string, std::pair<RandomDistributor<const MSRoute*>*, bool> > RouteDistDict;
 
     /// The dictionary container
     static RouteDistDict myDistDict;
 
+    /// @brief The pool of shared edge vectors by content hash
+    static std::unordered_multimap<size_t, std::weak_ptr<const ConstMSEdgeVector> > myEdgesPool;
+
 #ifdef HAVE_FOX
     /// @brief the mutex for the route dictionaries
     static FXMutex myDictMutex;
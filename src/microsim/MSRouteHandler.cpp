@@ -45,6 +45,7 @@
 #include <utils/xml/SUMOXMLDefinitions.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/TplConvert.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/common/StringTokenizer.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/options/OptionsCont.h>
@@ -468,6 +469,12 @@ MSRouteHandler::myEndElement(int element) {
 }
 
 
+void
+MSRouteHandler::myCheckBinaryEdges(const std::vector<std::string>& edgeIDs, const std::vector<std::vector<int> >& successors) {
+    FileHelpers::checkEdgeHeader<MSEdge>(edgeIDs, successors, getFileName());
+}
+
+
 void
 MSRouteHandler::closeRoute(const bool mayBeDisconnected) {
     std::string type = "vehicle";
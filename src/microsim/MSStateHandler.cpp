@@ -31,14 +31,21 @@
 #include <version.h>
 #endif
 
+#include <memory>
 #include <sstream>
 #include <utils/common/TplConvert.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/OutputDevice_String.h>
 #include <utils/xml/SUMOXMLDefinitions.h>
 #include <utils/xml/SUMOVehicleParserHelper.h>
+#include <utils/xml/SUMOSAXReader.h>
+#include <utils/xml/XMLSubSys.h>
+#include <utils/common/RandHelper.h>
+#include <utils/common/ToString.h>
 #include <microsim/devices/MSDevice_Routing.h>
 #include <microsim/MSEdge.h>
+#include <microsim/MSEventControl.h>
 #include <microsim/MSLane.h>
 #include <microsim/MSGlobals.h>
 #include <microsim/MSNet.h>
@@ -46,16 +53,30 @@
 #include <microsim/MSInsertionControl.h>
 #include <microsim/MSRoute.h>
 #include <microsim/MSVehicleControl.h>
+#include <microsim/devices/MSDevice_BTreceiver.h>
+#include <microsim/traffic_lights/MSTLLogicControl.h>
+#include <microsim/traffic_lights/MSTrafficLightLogic.h>
 #include "MSStateHandler.h"
 
 #include <mesosim/MESegment.h>
 #include <mesosim/MELoop.h>
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+std::map<std::string, MSStateHandler::Snapshot> MSStateHandler::mySnapshots;
+#ifdef HAVE_FOX
+FXWorkerThread::Pool MSStateHandler::myWriterPool;
+std::vector<OutputDevice*> MSStateHandler::myPendingFiles;
+std::string MSStateHandler::myWriteError;
+#endif
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
-MSStateHandler::MSStateHandler(const std::string& file, const SUMOTime offset) :
+MSStateHandler::MSStateHandler(const std::string& file, const SUMOTime offset, const bool removeVehicles) :
     MSRouteHandler(file, true),
     myOffset(offset),
     mySegment(0),
@@ -63,8 +84,10 @@ MSStateHandler::MSStateHandler(const std::string& file, const SUMOTime offset) :
     myAttrs(0),
     myLastParameterised(0) {
     myAmLoadingState = true;
-    const std::vector<std::string> vehIDs = OptionsCont::getOptions().getStringVector("load-state.remove-vehicles");
-    myVehiclesToRemove.insert(vehIDs.begin(), vehIDs.end());
+    if (removeVehicles) {
+        const std::vector<std::string> vehIDs = OptionsCont::getOptions().getStringVector("load-state.remove-vehicles");
+        myVehiclesToRemove.insert(vehIDs.begin(), vehIDs.end());
+    }
 }
 
 
@@ -73,13 +96,158 @@ MSStateHandler::~MSStateHandler() {
 
 
 void
-MSStateHandler::saveState(const std::string& file, SUMOTime step) {
+MSStateHandler::saveState(const std::string& file, SUMOTime step, bool async) {
+#ifdef HAVE_FOX
+    if (async) {
+        waitForAll();
+        const int len = (int)file.length();
+        OutputDevice_String buffer(len > 4 && file.substr(len - 4) == ".sbx");
+        writeState(buffer, step);
+        while (buffer.closeTag()) {}
+        OutputDevice& out = OutputDevice::getDevice(file);
+        if (myWriterPool.size() == 0) {
+            new FXWorkerThread(myWriterPool);
+        }
+        myWriterPool.add(new WriteTask(out, file, buffer.getString()));
+        myPendingFiles.push_back(&out);
+        return;
+    }
+#else
+    UNUSED_PARAMETER(async);
+#endif
     OutputDevice& out = OutputDevice::getDevice(file);
+    writeState(out, step);
+    out.close();
+}
+
+
+void
+MSStateHandler::saveSnapshot(const std::string& snapshotID, SUMOTime step) {
+    Snapshot& snapshot = mySnapshots[snapshotID];
+    snapshot.rngs.clear();
+    OutputDevice_String buffer(false);
+    writeState(buffer, step, true);
+    while (buffer.closeTag()) {}
+    snapshot.state = buffer.getString();
+    MSNet* const net = MSNet::getInstance();
+    snapshot.events[0] = net->getBeginOfTimestepEvents()->getEvents();
+    snapshot.events[1] = net->getEndOfTimestepEvents()->getEvents();
+    snapshot.events[2] = net->getInsertionEvents()->getEvents();
+    for (std::mt19937* const rng : getRNGs()) {
+        snapshot.rngs.push_back(*rng);
+    }
+}
+
+
+void
+MSStateHandler::restoreSnapshot(const std::string& snapshotID) {
+    std::map<std::string, Snapshot>::const_iterator it = mySnapshots.find(snapshotID);
+    if (it == mySnapshots.end()) {
+        throw ProcessError("Unknown snapshot '" + snapshotID + "'.");
+    }
+    const Snapshot& snapshot = it->second;
+    MSNet* const net = MSNet::getInstance();
+    net->clearState();
+    // routes and types of the snapshot are known already
+    const bool stateLoaded = MSGlobals::gStateLoaded;
+    MSGlobals::gStateLoaded = true;
+    MSStateHandler h("", 0, false);
+    try {
+        std::unique_ptr<SUMOSAXReader> reader(XMLSubSys::getSAXReader(h));
+        reader->parseString(snapshot.state);
+    } catch (ProcessError&) {
+        MSGlobals::gStateLoaded = stateLoaded;
+        throw;
+    }
+    MSGlobals::gStateLoaded = stateLoaded;
+    net->setCurrentTimeStep(h.getTime());
+    int numLost = net->getBeginOfTimestepEvents()->restoreEvents(snapshot.events[0]);
+    numLost += net->getEndOfTimestepEvents()->restoreEvents(snapshot.events[1]);
+    numLost += net->getInsertionEvents()->restoreEvents(snapshot.events[2]);
+    if (numLost > 0) {
+        WRITE_WARNING(toString(numLost) + " event(s) executed for the last time after the snapshot could not be restored.");
+    }
+    // the generators are reset last because rebuilding the vehicles may draw from them
+    const std::vector<std::mt19937*> rngs = getRNGs();
+    for (int i = 0; i < (int)rngs.size(); i++) {
+        *rngs[i] = snapshot.rngs[i];
+    }
+}
+
+
+void
+MSStateHandler::clearSnapshots() {
+    mySnapshots.clear();
+}
+
+
+std::vector<std::mt19937*>
+MSStateHandler::getRNGs() {
+    std::vector<std::mt19937*> result;
+    result.push_back(RandHelper::getRNG());
+    result.push_back(MSRouteHandler::getParsingRNG());
+    result.push_back(MSDevice::getEquipmentRNG());
+    result.push_back(MSDevice_BTreceiver::getRecognitionRNG());
+    return result;
+}
+
+
+void
+MSStateHandler::waitForAll() {
+#ifdef HAVE_FOX
+    if (myWriterPool.size() > 0) {
+        myWriterPool.waitAll();
+    }
+    for (OutputDevice* const out : myPendingFiles) {
+        out->close();
+    }
+    myPendingFiles.clear();
+    if (myWriteError != "") {
+        const std::string error = myWriteError;
+        myWriteError = "";
+        throw IOError(error);
+    }
+#endif
+}
+
+
+void
+MSStateHandler::cleanup() {
+    try {
+        waitForAll();
+    } catch (IOError& e) {
+        WRITE_ERROR(e.what());
+    }
+#ifdef HAVE_FOX
+    // we cannot wait for the static destructor because the output devices are gone by then
+    myWriterPool.clear();
+#endif
+}
+
+
+#ifdef HAVE_FOX
+void
+MSStateHandler::WriteTask::run(FXWorkerThread* /* context */) {
+    // errors must not leave the thread, they are reported by waitForAll
+    try {
+        myOut << myContent;
+        if (!myOut.ok()) {
+            myWriteError = "Could not write state file '" + myFile + "'.";
+        }
+    } catch (IOError& e) {
+        myWriteError = e.what();
+    }
+}
+#endif
+
+
+void
+MSStateHandler::writeState(OutputDevice& out, SUMOTime step, const bool snapshot) {
     out.writeHeader<MSEdge>(SUMO_TAG_SNAPSHOT);
     out.writeAttr("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance").writeAttr("xsi:noNamespaceSchemaLocation", "http://sumo.dlr.de/xsd/state_file.xsd");
     out.writeAttr(SUMO_ATTR_VERSION, VERSION_STRING).writeAttr(SUMO_ATTR_TIME, time2string(step));
     MSRoute::dict_saveState(out);
-    MSNet::getInstance()->getInsertionControl().saveState(out);
+    MSNet::getInstance()->getInsertionControl().saveState(out, snapshot);
     MSNet::getInstance()->getVehicleControl().saveState(out);
     MSVehicleTransfer::getInstance()->saveState(out);
     if (MSGlobals::gUseMesoSim) {
@@ -96,7 +264,15 @@ MSStateHandler::saveState(const std::string& file, SUMOTime step) {
             }
         }
     }
-    out.close();
+    if (snapshot) {
+        const MSTLLogicControl& tlc = MSNet::getInstance()->getTLSControl();
+        for (const std::string& id : tlc.getAllTLIds()) {
+            const MSTrafficLightLogic* const logic = tlc.getActive(id);
+            if (logic->getNextSwitchTime() >= 0) {
+                logic->saveState(out);
+            }
+        }
+    }
 }
 
 
@@ -122,12 +298,28 @@ MSStateHandler::myStartElement(int element, const SUMOSAXAttributes& attrs) {
             break;
         }
         case SUMO_TAG_FLOWSTATE: {
+            const std::string id = attrs.getString(SUMO_ATTR_ID);
+            if (attrs.hasAttribute(SUMO_ATTR_NUMBER)) {
+                // restoring a snapshot of this simulation
+                if (!MSNet::getInstance()->getInsertionControl().restoreFlow(id, attrs.getInt(SUMO_ATTR_INDEX), attrs.getInt(SUMO_ATTR_NUMBER))) {
+                    WRITE_WARNING("Flow '" + id + "' has ended and cannot be restored.");
+                }
+                break;
+            }
             SUMOVehicleParameter* pars = new SUMOVehicleParameter();
-            pars->id = attrs.getString(SUMO_ATTR_ID);
+            pars->id = id;
             MSNet::getInstance()->getInsertionControl().addFlow(pars,
                     attrs.getInt(SUMO_ATTR_INDEX));
             break;
         }
+        case SUMO_TAG_TLLOGIC: {
+            MSTLLogicControl& tlc = MSNet::getInstance()->getTLSControl();
+            const std::string id = attrs.getString(SUMO_ATTR_ID);
+            tlc.switchTo(id, attrs.getString(SUMO_ATTR_PROGRAMID));
+            tlc.getActive(id)->loadState(tlc, myTime, attrs.getInt(SUMO_ATTR_INDEX),
+                                         string2time(attrs.getString(SUMO_ATTR_BEGIN)), string2time(attrs.getString(SUMO_ATTR_END)));
+            break;
+        }
         case SUMO_TAG_VTYPE: {
             myLastParameterised = myCurrentVType;
             break;
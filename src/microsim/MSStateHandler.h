@@ -29,14 +29,21 @@
 #include <config.h>
 #endif
 
+#include <random>
 #include <utils/common/SUMOTime.h>
+#include "MSEventControl.h"
 #include "MSRouteHandler.h"
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
 
 // ===========================================================================
 // class declarations
 // ===========================================================================
 class MESegment;
+class OutputDevice;
 
 
 // ===========================================================================
@@ -48,17 +55,67 @@ class MESegment;
  */
 class MSStateHandler : public MSRouteHandler {
 public:
-    /// standard constructor
-    MSStateHandler(const std::string& file, const SUMOTime offset);
+    /** @brief standard constructor
+     *
+     * @param[in] file The file to load the state from
+     * @param[in] offset The time offset of the loaded state
+     * @param[in] removeVehicles Whether the vehicles given by load-state.remove-vehicles shall be dropped
+     */
+    MSStateHandler(const std::string& file, const SUMOTime offset, const bool removeVehicles = true);
 
     /// standard destructor
     virtual ~MSStateHandler();
 
     /** @brief Saves the current state
+     *
+     * In asynchronous mode the state is serialized into memory and the file is
+     *  written by a background thread while the simulation continues. Writing
+     *  the previous asynchronous state must be finished before a new one starts.
      *
      * @param[in] file The file to write the state into
+     * @param[in] step The current time step
+     * @param[in] async Whether the file shall be written in the background
+     * @exception IOError If the file or the previous asynchronous state could not be written
      */
-    static void saveState(const std::string& file, SUMOTime step);
+    static void saveState(const std::string& file, SUMOTime step, bool async = false);
+
+    /** @brief Keeps the current state in memory for restoring it later in the same simulation
+     *
+     * In addition to the regular state this contains the progress of the flows,
+     *  the phases of the active traffic light programs, the execution times of
+     *  the pending events and the random number generators.
+     *
+     * @param[in] snapshotID The id to keep the state under (replacing an older snapshot with this id)
+     * @param[in] step The current time step
+     */
+    static void saveSnapshot(const std::string& snapshotID, SUMOTime step);
+
+    /** @brief Replaces the current state of the simulation by the given snapshot
+     *
+     * All vehicles are removed from the network and the vehicles of the snapshot
+     *  are inserted again, the simulation time is reset to the time of the snapshot.
+     *  Events which were pending at the snapshot get their execution time back and
+     *  the random number generators are reset.
+     *
+     * Not restored are events which were executed for the last time after the
+     *  snapshot (a warning is given), the edge weights collected by the rerouting
+     *  device, aggregated detector values and WAUT switches.
+     *
+     * @param[in] snapshotID The id of the snapshot
+     * @exception ProcessError If the snapshot is unknown or cannot be restored
+     */
+    static void restoreSnapshot(const std::string& snapshotID);
+
+    /// @brief forgets all snapshots
+    static void clearSnapshots();
+
+    /** @brief waits for the background writing of states and closes their files
+     * @exception IOError If a state could not be written
+     */
+    static void waitForAll();
+
+    /// @brief waits for the background writing and stops the writer thread
+    static void cleanup();
 
     SUMOTime getTime() const {
         return myTime;
@@ -91,6 +148,67 @@ protected:
     /// Ends the processing of a vehicle
     void closeVehicle();
 
+    /** @brief writes the complete state to the given device
+     *
+     * @param[in] out The device to write the state into
+     * @param[in] step The current time step
+     * @param[in] snapshot Whether the additional information for restoring a snapshot shall be written
+     */
+    static void writeState(OutputDevice& out, SUMOTime step, const bool snapshot = false);
+
+    /// @brief returns the random number generators which influence the simulation
+    static std::vector<std::mt19937*> getRNGs();
+
+private:
+    /**
+     * @struct Snapshot
+     * @brief A simulation state kept in memory
+     */
+    struct Snapshot {
+        /// @brief the state as XML (including the progress of the flows and the traffic light phases)
+        std::string state;
+        /// @brief the pending events of the begin of step, end of step and insertion event controls
+        std::vector<MSEventControl::PendingEvent> events[3];
+        /// @brief the random number generators
+        std::vector<std::mt19937> rngs;
+    };
+
+    /// @brief the snapshots by id
+    static std::map<std::string, Snapshot> mySnapshots;
+
+private:
+#ifdef HAVE_FOX
+    /**
+     * @class WriteTask
+     * @brief Writes a serialized state to its file
+     */
+    class WriteTask : public FXWorkerThread::Task {
+    public:
+        WriteTask(OutputDevice& out, const std::string& file, const std::string& content)
+            : myOut(out), myFile(file), myContent(content) {}
+        void run(FXWorkerThread* context);
+    private:
+        /// @brief the device of the state file
+        OutputDevice& myOut;
+        /// @brief the name of the state file
+        const std::string myFile;
+        /// @brief the serialized state
+        const std::string myContent;
+    private:
+        /// @brief Invalidated assignment operator.
+        WriteTask& operator=(const WriteTask&) = delete;
+    };
+
+    /// @brief the thread writing the states in the background
+    static FXWorkerThread::Pool myWriterPool;
+
+    /// @brief the state files which are written in the background (to be closed by the main thread)
+    static std::vector<OutputDevice*> myPendingFiles;
+
+    /// @brief the error which occured while writing in the background (to be reported by the main thread)
+    static std::string myWriteError;
+#endif
+
 private:
     const SUMOTime myOffset;
     SUMOTime myTime;
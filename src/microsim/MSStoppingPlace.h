@@ -127,6 +127,11 @@ public:
     void leaveFrom(SUMOVehicle* what);
 
 
+    /** @brief Forgets all stopped vehicles (called when the simulation state is replaced)
+     */
+    virtual void clearState();
+
+
     /** @brief Returns the last free position on this stop
      *
      * @return The last free position of this bus stop
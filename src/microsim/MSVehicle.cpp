@@ -111,6 +111,10 @@
 // static value definitions
 // ===========================================================================
 std::vector<MSLane*> MSVehicle::myEmptyLaneVector;
+std::unordered_map<MSVehicle::BestLanesKey, std::vector<std::vector<MSVehicle::LaneQ> >, MSVehicle::BestLanesKeyHash> MSVehicle::myBestLanesCache;
+#ifdef HAVE_FOX
+FXMutex MSVehicle::myBestLanesCacheMutex;
+#endif
 std::vector<MSTransportable*> MSVehicle::myEmptyTransportableVector;
 
 
@@ -3925,6 +3929,39 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
         }
     }
 
+    // without a stop the result only depends on the edges examined below, check whether it is known already
+    const bool useCache = nextStopEdge == myRoute->end();
+    BestLanesKey cacheKey(myType->getVehicleClass(), ConstMSEdgeVector());
+    if (useCache) {
+        int seen = 0;
+        double seenLength = 0;
+        for (MSRouteIterator ce = myCurrEdge; ce != myRoute->end(); ++ce) {
+            cacheKey.second.push_back(*ce);
+            if (seen > 8 || (seen > 4 && seenLength >= 3000)) {
+                // the edge following the examined ones determines the allowed lanes of the last one
+                break;
+            }
+            ++seen;
+            seenLength += (*ce)->getLanes()[0]->getLength();
+        }
+        bool found = false;
+        {
+#ifdef HAVE_FOX
+            // rerouting threads update the best lanes of the vehicles they reroute
+            FXMutexLock lock(myBestLanesCacheMutex);
+#endif
+            auto cached = myBestLanesCache.find(cacheKey);
+            if (cached != myBestLanesCache.end()) {
+                myBestLanes = cached->second;
+                found = true;
+            }
+        }
+        if (found) {
+            updateOccupancyAndCurrentBestLane(startLane);
+            return;
+        }
+    }
+
     // go forward along the next lanes;
     int seen = 0;
     double seenLength = 0;
@@ -4103,6 +4140,16 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
             }
         }
     }
+    if (useCache) {
+#ifdef HAVE_FOX
+        FXMutexLock lock(myBestLanesCacheMutex);
+#endif
+        if (myBestLanesCache.size() >= 10000) {
+            // keep the memory bounded if the vehicles use many different routes
+            myBestLanesCache.clear();
+        }
+        myBestLanesCache[cacheKey] = myBestLanes;
+    }
     updateOccupancyAndCurrentBestLane(startLane);
 #ifdef DEBUG_BESTLANES
     if (DEBUG_COND) {
@@ -4113,6 +4160,25 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
 }
 
 
+void
+MSVehicle::clearBestLanesCache() {
+#ifdef HAVE_FOX
+    FXMutexLock lock(myBestLanesCacheMutex);
+#endif
+    myBestLanesCache.clear();
+}
+
+
+size_t
+MSVehicle::BestLanesKeyHash::operator()(const BestLanesKey& key) const {
+    size_t hash = (size_t)key.first;
+    for (const MSEdge* const e : key.second) {
+        hash = hash * 31 + e->getNumericalID();
+    }
+    return hash;
+}
+
+
 int
 MSVehicle::nextLinkPriority(const std::vector<MSLane*>& conts) {
     if (conts.size() < 2) {
@@ -43,6 +43,11 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#ifdef HAVE_FOX
+#include <fx.h>
+#include <FXThread.h>
+#endif
 #include "MSGlobals.h"
 #include "MSVehicleType.h"
 #include "MSBaseVehicle.h"
@@ -846,11 +851,18 @@ public:
      * If no starting lane ("startLane") is given, the vehicle's current lane ("myLane")
      *  is used as start of best lanes building.
      *
+     * If no stop or arrival lane is involved, the rebuilt lanes (without occupation) only
+     *  depend on the upcoming edges and the vehicle class and are shared between the
+     *  vehicles using the best lanes cache.
+     *
      * @param[in] forceRebuild Whether the best lanes container shall be rebuilt even if the vehicle's edge has not changed
      * @param[in] startLane The lane the process shall start at ("myLane" will be used if ==0)
      */
     void updateBestLanes(bool forceRebuild = false, const MSLane* startLane = 0);
 
+    /// @brief clears the best lanes cache (to be called whenever lane permissions or the network change)
+    static void clearBestLanesCache();
+
 
     /** @brief Returns the best sequence of lanes to continue the route starting at myLane
      * @return The bestContinuations of the LaneQ for myLane (see LaneQ)
@@ -1747,6 +1759,22 @@ protected:
     static std::vector<MSLane*> myEmptyLaneVector;
     static std::vector<MSTransportable*> myEmptyTransportableVector;
 
+    /// @brief the key of the best lanes cache: the vehicle class and the upcoming edges (including the one after the look ahead)
+    typedef std::pair<SUMOVehicleClass, ConstMSEdgeVector> BestLanesKey;
+
+    /// @brief hash function for the best lanes cache
+    struct BestLanesKeyHash {
+        size_t operator()(const BestLanesKey& key) const;
+    };
+
+    /// @brief the best lanes (without occupation) computed for the upcoming edges of a vehicle class
+    static std::unordered_map<BestLanesKey, std::vector<std::vector<LaneQ> >, BestLanesKeyHash> myBestLanesCache;
+
+#ifdef HAVE_FOX
+    /// @brief the mutex for the best lanes cache (best lanes are also updated by the rerouting threads)
+    static FXMutex myBestLanesCacheMutex;
+#endif
+
     /// @brief The vehicle's list of stops
     std::list<Stop> myStops;
 
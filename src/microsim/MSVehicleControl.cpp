@@ -149,6 +149,19 @@ MSVehicleControl::setState(int runningVehNo, int loadedVehNo, int endedVehNo, do
 }
 
 
+void
+MSVehicleControl::clearState() {
+    for (VehicleDictType::iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
+        delete(*i).second;
+    }
+    myVehicleDict.clear();
+    myWaiting.clear();
+    myWaitingForPerson = 0;
+    myWaitingForContainer = 0;
+    myPTVehicles.clear();
+}
+
+
 void
 MSVehicleControl::saveState(OutputDevice& out) {
     out.openTag(SUMO_TAG_DELAY);
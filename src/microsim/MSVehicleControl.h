@@ -460,6 +460,13 @@ public:
     /** @brief Saves the current state into the given stream
      */
     void saveState(OutputDevice& out);
+
+    /** @brief Deletes all vehicles without generating output
+     *
+     * Called when the simulation state is replaced. The counters are
+     *  restored by setState afterwards.
+     */
+    void clearState();
     /// @}
 
     /// @brief avoid counting a vehicle twice if it was loaded from state and route input
@@ -214,6 +214,12 @@ MSVehicleTransfer::loadState(const SUMOSAXAttributes& attrs, const SUMOTime offs
 }
 
 
+void
+MSVehicleTransfer::clearState() {
+    myVehicles.clear();
+}
+
+
 
 /****************************************************************************/
 
@@ -114,6 +114,9 @@ public:
     /** @brief Loads one transfer vehicle state from the given descriptionn */
     void loadState(const SUMOSAXAttributes& attrs, const SUMOTime offset, MSVehicleControl& vc);
 
+    /** @brief Forgets all vehicles (called when the simulation state is replaced) */
+    void clearState();
+
     /** @brief Returns the instance of this object
      * @return The singleton instance
      */
@@ -79,6 +79,11 @@ public:
         return myRange;
     }
 
+    /// @brief Returns the random number generator for the recognition
+    static std::mt19937* getRecognitionRNG() {
+        return &sRecognitionRNG;
+    }
+
 
 
 public:
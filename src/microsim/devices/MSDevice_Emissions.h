@@ -107,6 +107,11 @@ public:
         return "emissions";
     }
 
+    /// @brief the notifications only modify the device itself
+    bool isVehicleLocal() const {
+        return true;
+    }
+
     /** @brief Called on writing tripinfo output
      *
      * @param[in] os The stream to write the information into
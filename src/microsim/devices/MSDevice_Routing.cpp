@@ -28,6 +28,8 @@
 #include <config.h>
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include "MSDevice_Routing.h"
 #include <microsim/MSNet.h>
 #include <microsim/MSLane.h>
@@ -40,6 +42,8 @@
 #include <utils/common/WrappingCommand.h>
 #include <utils/common/StaticCommand.h>
 #include <utils/common/StringUtils.h>
+#include <utils/xml/SAXWeightsHandler.h>
+#include <utils/xml/XMLSubSys.h>
 #include <utils/vehicle/DijkstraRouter.h>
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
@@ -57,8 +61,12 @@ int MSDevice_Routing::myAdaptationSteps;
 int MSDevice_Routing::myAdaptationStepsIndex = 0;
 SUMOTime MSDevice_Routing::myAdaptationInterval = -1;
 SUMOTime MSDevice_Routing::myLastAdaptation = -1;
+std::vector<std::vector<std::pair<float, float> > > MSDevice_Routing::myTravelTimeProfiles;
+double MSDevice_Routing::myProfilePeriod = 86400.;
+double MSDevice_Routing::myProfileHorizon = 900.;
 bool MSDevice_Routing::myWithTaz;
 std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> MSDevice_Routing::myCachedRoutes;
+CachingRouter<MSEdge, SUMOVehicle>::Cache* MSDevice_Routing::myRouteCache = nullptr;
 SUMOAbstractRouter<MSEdge, SUMOVehicle>* MSDevice_Routing::myRouter = 0;
 AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* MSDevice_Routing::myRouterWithProhibited = 0;
 double MSDevice_Routing::myRandomizeWeightsFactor = 0;
@@ -67,6 +75,44 @@ FXWorkerThread::Pool MSDevice_Routing::myThreadPool;
 #endif
 
 
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSDevice_Routing::ProfileRetriever
+ * @brief Collects loaded edge travel times as support points of the edge profiles
+ */
+class MSDevice_Routing::ProfileRetriever : public SAXWeightsHandler::EdgeFloatTimeLineRetriever {
+public:
+    /// @brief Constructor
+    ProfileRetriever() {}
+
+    /// @brief Destructor
+    ~ProfileRetriever() {}
+
+    /** @brief Adds the travel time as support point at the interval middle
+     *
+     * @param[in] id The id of the edge to add a travel time for
+     * @param[in] val The travel time
+     * @param[in] beg The begin of the interval the travel time is valid for
+     * @param[in] end The end of the interval the travel time is valid for
+     * @see SAXWeightsHandler::EdgeFloatTimeLineRetriever::addEdgeWeight
+     */
+    void addEdgeWeight(const std::string& id, double val, double beg, double end) const {
+        const MSEdge* const edge = MSEdge::dictionary(id);
+        if (edge == nullptr) {
+            WRITE_ERROR("Trying to set the travel time profile for the unknown edge '" + id + "'.");
+            return;
+        }
+        double t = fmod((beg + end) / 2., myProfilePeriod);
+        if (t < 0) {
+            t += myProfilePeriod;
+        }
+        myTravelTimeProfiles[edge->getNumericalID()].push_back(std::make_pair((float)t, (float)val));
+    }
+};
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
@@ -111,8 +157,21 @@ MSDevice_Routing::insertOptions(OptionsCont& oc) {
     oc.doRegister("device.rerouting.output", new Option_FileName());
     oc.addDescription("device.rerouting.output", "Routing", "Save adapting weights to FILE");
 
+    oc.doRegister("device.rerouting.profile-files", new Option_FileName());
+    oc.addDescription("device.rerouting.profile-files", "Routing", "Load edge travel time profiles (edgeData of previous runs) for time-dependent routing from FILE");
+
+    oc.doRegister("device.rerouting.profile-period", new Option_String("86400", "TIME"));
+    oc.addDescription("device.rerouting.profile-period", "Routing", "The period after which the loaded travel time profiles repeat");
+
+    oc.doRegister("device.rerouting.profile-horizon", new Option_String("900", "TIME"));
+    oc.addDescription("device.rerouting.profile-horizon", "Routing", "The look-ahead time after which only the travel time profiles are used instead of current edge speeds");
+
+    oc.doRegister("device.rerouting.cache-size", new Option_Integer(0));
+    oc.addDescription("device.rerouting.cache-size", "Routing", "The maximum number of routes to reuse for identical queries until the edge weights change");
+
     myEdgeWeightSettingCommand = 0;
     myEdgeSpeeds.clear();
+    myTravelTimeProfiles.clear();
     myAdaptationInterval = -1;
     myAdaptationSteps = -1;
     myLastAdaptation = -1;
@@ -139,6 +198,26 @@ MSDevice_Routing::checkOptions(OptionsCont& oc) {
         WRITE_ERROR("The value for device.rerouting.adaptation-weight must be between 0 and 1!");
         ok = false;
     }
+    if (string2time(oc.getString("device.rerouting.profile-period")) <= 0) {
+        WRITE_ERROR("The value for device.rerouting.profile-period must be positive!");
+        ok = false;
+    }
+    if (string2time(oc.getString("device.rerouting.profile-horizon")) < 0) {
+        WRITE_ERROR("Negative value for device.rerouting.profile-horizon!");
+        ok = false;
+    }
+    if (oc.isSet("device.rerouting.profile-files") && !oc.isUsableFileList("device.rerouting.profile-files")) {
+        ok = false;
+    }
+    if (oc.isSet("device.rerouting.profile-files") && (oc.getString("routing-algorithm") == "CH" || oc.getString("routing-algorithm") == "CHWrapper")) {
+        // the contraction hierarchy is built for a single time and would ignore the profiles
+        WRITE_ERROR("Travel time profiles are not supported by the routing algorithm '" + oc.getString("routing-algorithm") + "'.");
+        ok = false;
+    }
+    if (oc.getInt("device.rerouting.cache-size") < 0) {
+        WRITE_ERROR("Negative value for device.rerouting.cache-size!");
+        ok = false;
+    }
 #ifndef HAVE_FOX
     if (oc.getInt("device.rerouting.threads") > 1) {
         WRITE_ERROR("Parallel routing is only possible when compiled with Fox.");
@@ -247,10 +326,92 @@ MSDevice_Routing::initEdgeWeights() {
         }
         myLastAdaptation = MSNet::getInstance()->getCurrentTimeStep();
         myRandomizeWeightsFactor = oc.getFloat("weights.random-factor");
+        if (oc.isSet("device.rerouting.profile-files")) {
+            loadTravelTimeProfiles(oc);
+        }
+        if (oc.getInt("device.rerouting.cache-size") > 0) {
+            // cached routes ignore the departure time and would freeze the randomization
+            if (!myTravelTimeProfiles.empty() || myRandomizeWeightsFactor != 1) {
+                WRITE_WARNING("The route cache is disabled for time dependent or randomized edge weights.");
+            } else {
+                myRouteCache = new CachingRouter<MSEdge, SUMOVehicle>::Cache(oc.getInt("device.rerouting.cache-size"));
+            }
+        }
     }
 }
 
 
+void
+MSDevice_Routing::loadTravelTimeProfiles(const OptionsCont& oc) {
+    myProfilePeriod = STEPS2TIME(string2time(oc.getString("device.rerouting.profile-period")));
+    myProfileHorizon = STEPS2TIME(string2time(oc.getString("device.rerouting.profile-horizon")));
+    myTravelTimeProfiles = std::vector<std::vector<std::pair<float, float> > >(myEdgeSpeeds.size());
+    ProfileRetriever retriever;
+    std::vector<SAXWeightsHandler::ToRetrieveDefinition*> retrieverDefs;
+    retrieverDefs.push_back(new SAXWeightsHandler::ToRetrieveDefinition("traveltime", true, retriever));
+    SAXWeightsHandler handler(retrieverDefs, "");
+    for (const std::string& file : oc.getStringVector("device.rerouting.profile-files")) {
+        WRITE_MESSAGE("Loading travel time profiles from '" + file + "'...");
+        if (!XMLSubSys::runParser(handler, file)) {
+            throw ProcessError("Could not load travel time profiles from '" + file + "'.");
+        }
+    }
+    // sort the support points and merge the ones from different files falling on the same time
+    for (std::vector<std::pair<float, float> >& profile : myTravelTimeProfiles) {
+        std::sort(profile.begin(), profile.end());
+        std::vector<std::pair<float, float> > merged;
+        int count = 0;
+        for (const std::pair<float, float>& point : profile) {
+            if (!merged.empty() && merged.back().first == point.first) {
+                merged.back().second += (point.second - merged.back().second) / (float)(++count);
+            } else {
+                merged.push_back(point);
+                count = 1;
+            }
+        }
+        merged.shrink_to_fit();
+        profile.swap(merged);
+    }
+}
+
+
+double
+MSDevice_Routing::getProfileTravelTime(const int id, const double t) {
+    if (id >= (int)myTravelTimeProfiles.size() || myTravelTimeProfiles[id].empty()) {
+        return -1;
+    }
+    const std::vector<std::pair<float, float> >& profile = myTravelTimeProfiles[id];
+    double periodTime = fmod(t, myProfilePeriod);
+    if (periodTime < 0) {
+        periodTime += myProfilePeriod;
+    }
+    std::vector<std::pair<float, float> >::const_iterator next = std::upper_bound(profile.begin(), profile.end(), periodTime,
+    [](const double time, const std::pair<float, float>& point) {
+        return time < point.first;
+    });
+    // the profile wraps around at the period boundaries
+    double prevTime, nextTime, prevValue, nextValue;
+    if (next == profile.begin()) {
+        prevTime = profile.back().first - myProfilePeriod;
+        prevValue = profile.back().second;
+    } else {
+        prevTime = (next - 1)->first;
+        prevValue = (next - 1)->second;
+    }
+    if (next == profile.end()) {
+        nextTime = profile.front().first + myProfilePeriod;
+        nextValue = profile.front().second;
+    } else {
+        nextTime = next->first;
+        nextValue = next->second;
+    }
+    if (nextTime <= prevTime) {
+        return prevValue;
+    }
+    return prevValue + (nextValue - prevValue) * (periodTime - prevTime) / (nextTime - prevTime);
+}
+
+
 SUMOTime
 MSDevice_Routing::preInsertionReroute(const SUMOTime currentTime) {
     if (mySkipRouting == currentTime) {
@@ -285,10 +446,22 @@ MSDevice_Routing::wrappedRerouteCommandExecute(SUMOTime currentTime) {
 
 
 double
-MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, double) {
+MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, double t) {
     const int id = e->getNumericalID();
     if (id < (int)myEdgeSpeeds.size()) {
         double effort = MAX2(e->getLength() / MAX2(myEdgeSpeeds[id], NUMERICAL_EPS), e->getMinimumTravelTime(v));
+        if (!myTravelTimeProfiles.empty()) {
+            const double profileTT = getProfileTravelTime(id, t);
+            if (profileTT >= 0) {
+                // the further we look ahead, the more we trust the profile instead of the current state
+                const double lookAhead = t - SIMTIME;
+                double profileWeight = lookAhead > 0 ? 1. : 0.;
+                if (myProfileHorizon > 0) {
+                    profileWeight = MIN2(MAX2(lookAhead / myProfileHorizon, 0.), 1.);
+                }
+                effort = MAX2(effort * (1. - profileWeight) + profileTT * profileWeight, e->getMinimumTravelTime(v));
+            }
+        }
         if (myRandomizeWeightsFactor != 1) {
             effort *= RandHelper::rand((double)1, myRandomizeWeightsFactor);
         }
@@ -315,6 +488,9 @@ MSDevice_Routing::adaptEdgeEfforts(SUMOTime currentTime) {
         it->second->release();
     }
     myCachedRoutes.clear();
+    if (myRouteCache != nullptr) {
+        myRouteCache->invalidate();
+    }
     const MSEdgeVector& edges = MSNet::getInstance()->getEdgeControl().getEdges();
     if (myAdaptationSteps > 0) {
         // moving average
@@ -432,6 +608,9 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
         } else {
             throw ProcessError("Unknown routing algorithm '" + routingAlgorithm + "'!");
         }
+        if (myRouteCache != nullptr) {
+            myRouter = new CachingRouter<MSEdge, SUMOVehicle>(myRouter, *myRouteCache);
+        }
     }
 #ifdef HAVE_FOX
     if (needThread) {
@@ -494,6 +673,9 @@ MSDevice_Routing::setParameter(const std::string& key, const std::string& value)
             throw InvalidArgument("Edge '" + edgeID + "' is invalid for parameter setting of '" + deviceName() + "'");
         }
         myEdgeSpeeds[edge->getNumericalID()] = edge->getLength() / doubleValue;
+        if (myRouteCache != nullptr) {
+            myRouteCache->invalidate();
+        }
     } else if (key == "period") {
         const SUMOTime oldPeriod = myPeriod;
         myPeriod = TIME2STEPS(doubleValue);
@@ -521,11 +703,12 @@ MSDevice_Routing::cleanup() {
         myThreadPool.clear();
         // router deletion is done in thread destructor
         myRouter = 0;
-        return;
     }
 #endif
     delete myRouter;
     myRouter = 0;
+    delete myRouteCache;
+    myRouteCache = nullptr;
 }
 
 
@@ -36,6 +36,7 @@
 #include <utils/common/WrappingCommand.h>
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <utils/vehicle/AStarRouter.h>
+#include <utils/vehicle/CachingRouter.h>
 #include <microsim/MSVehicle.h>
 #include "MSDevice.h"
 
@@ -165,6 +166,11 @@ public:
         return "rerouting";
     }
 
+    /// @brief the notifications only modify the device itself
+    bool isVehicleLocal() const {
+        return true;
+    }
+
 
     /// @brief initiate the rerouting, create router / thread pool on first use
     void reroute(const SUMOTime currentTime, const bool onInit = false);
@@ -185,6 +191,17 @@ public:
     /// @brief return current travel speed assumption
     static double getAssumedSpeed(const MSEdge* edge);
 
+    /** @brief Returns the travel time the loaded profile predicts for entering the edge at the given time
+     *
+     * The profile is interpolated linearly between the interval midpoints of the loaded
+     *  data and repeats with the period given by option device.rerouting.profile-period.
+     *
+     * @param[in] id The numerical id of the edge
+     * @param[in] t The time (in s) at which the edge is entered
+     * @return The predicted travel time or -1 if there is no profile for the edge
+     */
+    static double getProfileTravelTime(const int id, const double t);
+
     /// @brief try to retrieve the given parameter from this device. Throw exception for unsupported key
     std::string getParameter(const std::string& key) const;
 
@@ -193,6 +210,9 @@ public:
 
 
 private:
+    /// @brief retriever for the travel time profiles (defined in the cpp to avoid the SAX includes)
+    class ProfileRetriever;
+
 #ifdef HAVE_FOX
     /**
      * @class WorkerThread
@@ -245,6 +265,9 @@ private:
     /// @brief initialize the edge weights if not done before
     static void initEdgeWeights();
 
+    /// @brief load the travel time profiles given with device.rerouting.profile-files
+    static void loadTravelTimeProfiles(const OptionsCont& oc);
+
     /** @brief Performs rerouting before insertion into the network
      *
      * A new route is computed by calling the reroute method. If the routing
@@ -280,8 +303,9 @@ private:
      * This method is given to the used router in order to obtain the efforts
      *  to pass an edge from the internal edge weights container.
      *
-     * The time is not used, here, as the current simulation state is
-     *  used in an aggregated way.
+     * If travel time profiles were loaded, the current state is blended with
+     *  the profile prediction for the given time. The farther the time lies in
+     *  the future, the more weight the profile gets.
      *
      * @param[in] e The edge for which the effort to be passed shall be returned
      * @param[in] v The vehicle that is rerouted
@@ -351,12 +375,24 @@ private:
     /// @brief The container of edge speeds
     static std::vector<std::vector<double> > myPastEdgeSpeeds;
 
+    /// @brief The travel time profiles as (time within period, travel time) pairs sorted by time, indexed by edge
+    static std::vector<std::vector<std::pair<float, float> > > myTravelTimeProfiles;
+
+    /// @brief The period (in s) after which the travel time profiles repeat
+    static double myProfilePeriod;
+
+    /// @brief The look-ahead time (in s) after which only the profiles are used
+    static double myProfileHorizon;
+
     /// @brief whether taz shall be used at initial rerouting
     static bool myWithTaz;
 
     /// @brief The container of pre-calculated routes
     static std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> myCachedRoutes;
 
+    /// @brief The bounded cache of computed routes shared by all routers (if enabled)
+    static CachingRouter<MSEdge, SUMOVehicle>::Cache* myRouteCache;
+
     /// @brief The router to use
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
 
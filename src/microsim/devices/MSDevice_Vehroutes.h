@@ -117,6 +117,11 @@ public:
         return "vehroute";
     }
 
+    /// @brief the notifications only modify the device itself
+    bool isVehicleLocal() const {
+        return true;
+    }
+
     void stopEnded(const MSVehicle::Stop& stop);
 
     /** @brief Called on writing vehroutes output
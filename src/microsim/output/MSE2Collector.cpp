@@ -673,6 +673,21 @@ MSE2Collector::notifyMove(SUMOVehicle& veh, double oldPos,
     }
 }
 
+void
+MSE2Collector::clearState() {
+    for (std::vector<MoveNotificationInfo*>::iterator j = myMoveNotifications.begin(); j != myMoveNotifications.end(); ++j) {
+        delete *j;
+    }
+    myMoveNotifications.clear();
+    for (VehicleInfoMap::iterator j = myVehicleInfos.begin(); j != myVehicleInfos.end(); ++j) {
+        delete j->second;
+    }
+    myVehicleInfos.clear();
+    myLeftVehicles.clear();
+    myHaltingVehicleDurations.clear();
+}
+
+
 bool
 MSE2Collector::notifyLeave(SUMOVehicle& veh, double /* lastPos */, MSMoveReminder::Notification reason, const MSLane* enteredLane) {
 #ifdef DEBUG_E2_NOTIFY_ENTER_AND_LEAVE
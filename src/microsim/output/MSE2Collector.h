@@ -323,6 +323,12 @@ public:
      * @see MSMoveReminder::Notification
      */
     virtual bool notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason, const MSLane* enteredLane);
+
+
+    /** @brief Forgets the vehicles on the detector
+     * @see MSMoveReminder::clearState
+     */
+    virtual void clearState();
     /// @}
 
 
@@ -196,6 +196,12 @@ MSE3Collector::reset() {
 }
 
 
+void
+MSE3Collector::clearState() {
+    myEnteredContainer.clear();
+}
+
+
 
 void
 MSE3Collector::enter(const SUMOVehicle& veh, const double entryTimestep, const double fractionTimeOnDet) {
@@ -118,6 +118,13 @@ public:
         * @see MSMoveReminder::notifyLeave
         */
         bool notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Notification reason, const MSLane* enteredLane = 0);
+
+        /** @brief Lets the collector forget the vehicles inside the area
+         * @see MSMoveReminder::clearState
+         */
+        void clearState() {
+            myCollector.clearState();
+        }
         /// @}
 
 
@@ -194,6 +201,13 @@ public:
         * @see MSMoveReminder::notifyLeave
         */
         bool notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Notification reason, const MSLane* enteredLane = 0);
+
+        /** @brief Lets the collector forget the vehicles inside the area
+         * @see MSMoveReminder::clearState
+         */
+        void clearState() {
+            myCollector.clearState();
+        }
         //@}
 
 
@@ -240,6 +254,11 @@ public:
     void reset();
 
 
+    /** @brief Forgets the vehicles inside the area (called when the simulation state is replaced)
+     */
+    void clearState();
+
+
     /** @brief Called if a vehicle touches an entry-cross-section.
      *
      * Inserts vehicle into internal containers.
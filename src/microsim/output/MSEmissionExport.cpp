@@ -46,26 +46,40 @@ MSEmissionExport::write(OutputDevice& of, SUMOTime timestep, int precision) {
     of.openTag("timestep").writeAttr("time", time2string(timestep));
     of.setPrecision(precision);
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
+    // compute the emissions of all vehicles at once
+    std::vector<const SUMOVehicle*> vehicles;
+    std::vector<SUMOEmissionClass> classes;
+    std::vector<double> speeds, accels, slopes;
     for (MSVehicleControl::constVehIt it = vc.loadedVehBegin(); it != vc.loadedVehEnd(); ++it) {
         const SUMOVehicle* veh = it->second;
-        const MSVehicle* microVeh = dynamic_cast<const MSVehicle*>(veh);
         if (veh->isOnRoad()) {
-            std::string fclass = veh->getVehicleType().getID();
-            fclass = fclass.substr(0, fclass.find_first_of("@"));
-            PollutantsInterface::Emissions emiss = PollutantsInterface::computeAll(veh->getVehicleType().getEmissionClass(), veh->getSpeed(), veh->getAcceleration(), veh->getSlope());
-            of.openTag("vehicle").writeAttr("id", veh->getID()).writeAttr("eclass", PollutantsInterface::getName(veh->getVehicleType().getEmissionClass()));
-            of.writeAttr("CO2", emiss.CO2).writeAttr("CO", emiss.CO).writeAttr("HC", emiss.HC).writeAttr("NOx", emiss.NOx);
-            of.writeAttr("PMx", emiss.PMx).writeAttr("fuel", emiss.fuel).writeAttr("electricity", emiss.electricity);
-            of.writeAttr("noise", HelpersHarmonoise::computeNoise(veh->getVehicleType().getEmissionClass(), veh->getSpeed(), veh->getAcceleration()));
-            of.writeAttr("route", veh->getRoute().getID()).writeAttr("type", fclass);
-            if (microVeh != 0) {
-                of.writeAttr("waiting", microVeh->getWaitingSeconds());
-                of.writeAttr("lane", microVeh->getLane()->getID());
-            }
-            of.writeAttr("pos", veh->getPositionOnLane()).writeAttr("speed", veh->getSpeed());
-            of.writeAttr("angle", GeomHelper::naviDegree(veh->getAngle())).writeAttr("x", veh->getPosition().x()).writeAttr("y", veh->getPosition().y());
-            of.closeTag();
+            vehicles.push_back(veh);
+            classes.push_back(veh->getVehicleType().getEmissionClass());
+            speeds.push_back(veh->getSpeed());
+            accels.push_back(veh->getAcceleration());
+            slopes.push_back(veh->getSlope());
+        }
+    }
+    std::vector<PollutantsInterface::Emissions> emissions;
+    PollutantsInterface::computeAll(classes, speeds, accels, slopes, emissions);
+    for (int i = 0; i < (int)vehicles.size(); ++i) {
+        const SUMOVehicle* veh = vehicles[i];
+        const MSVehicle* microVeh = dynamic_cast<const MSVehicle*>(veh);
+        std::string fclass = veh->getVehicleType().getID();
+        fclass = fclass.substr(0, fclass.find_first_of("@"));
+        const PollutantsInterface::Emissions& emiss = emissions[i];
+        of.openTag("vehicle").writeAttr("id", veh->getID()).writeAttr("eclass", PollutantsInterface::getName(veh->getVehicleType().getEmissionClass()));
+        of.writeAttr("CO2", emiss.CO2).writeAttr("CO", emiss.CO).writeAttr("HC", emiss.HC).writeAttr("NOx", emiss.NOx);
+        of.writeAttr("PMx", emiss.PMx).writeAttr("fuel", emiss.fuel).writeAttr("electricity", emiss.electricity);
+        of.writeAttr("noise", HelpersHarmonoise::computeNoise(veh->getVehicleType().getEmissionClass(), veh->getSpeed(), veh->getAcceleration()));
+        of.writeAttr("route", veh->getRoute().getID()).writeAttr("type", fclass);
+        if (microVeh != 0) {
+            of.writeAttr("waiting", microVeh->getWaitingSeconds());
+            of.writeAttr("lane", microVeh->getLane()->getID());
         }
+        of.writeAttr("pos", veh->getPositionOnLane()).writeAttr("speed", veh->getSpeed());
+        of.writeAttr("angle", GeomHelper::naviDegree(veh->getAngle())).writeAttr("x", veh->getPosition().x()).writeAttr("y", veh->getPosition().y());
+        of.closeTag();
     }
     of.setPrecision(gPrecision);
     of.closeTag();
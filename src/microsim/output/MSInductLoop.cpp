@@ -147,6 +147,12 @@ MSInductLoop::notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Noti
 }
 
 
+void
+MSInductLoop::clearState() {
+    myVehiclesOnDet.clear();
+}
+
+
 double
 MSInductLoop::getCurrentSpeed() const {
     std::vector<VehicleData> d = collectVehiclesOnDet(MSNet::getInstance()->getCurrentTimeStep() - DELTA_T);
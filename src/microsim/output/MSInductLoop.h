@@ -150,6 +150,10 @@ public:
     bool notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Notification reason, const MSLane* enteredLane = 0);
 
 
+    /** @brief Forgets the vehicles on the detector
+     * @see MSMoveReminder::clearState
+     */
+    void clearState();
     //@}
 
 
@@ -137,6 +137,12 @@ MSInstantInductLoop::notifyLeave(SUMOVehicle& veh, double /* lastPos */, MSMoveR
 }
 
 
+void
+MSInstantInductLoop::clearState() {
+    myEntryTimes.clear();
+}
+
+
 void
 MSInstantInductLoop::writeXMLDetectorProlog(OutputDevice& dev) const {
     dev.writeXMLHeader("instantE1", "instant_e1_file.xsd");
@@ -112,6 +112,11 @@ public:
      * @see MSMoveReminder::notifyLeave
      */
     bool notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Notification reason, const MSLane* enteredLane = 0);
+
+    /** @brief Forgets the entry times of the vehicles on the detector
+     * @see MSMoveReminder::clearState
+     */
+    void clearState();
     //@}
 
 
@@ -99,6 +99,11 @@ MSStopOut::unloadedContainers(const SUMOVehicle* veh, int n) {
     myStopped[veh].unloadedContainers += n;
 }
 
+void
+MSStopOut::clearState() {
+    myStopped.clear();
+}
+
 void
 MSStopOut::stopEnded(const SUMOVehicle* veh, const MSVehicle::Stop& stop) {
     assert(veh != 0);
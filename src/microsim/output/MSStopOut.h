@@ -84,6 +84,9 @@ public:
 
     void stopEnded(const SUMOVehicle* veh, const MSVehicle::Stop& stop);
 
+    /// @brief forgets all stopped vehicles (called when the simulation state is replaced)
+    void clearState();
+
 
 private:
     struct StopInfo {
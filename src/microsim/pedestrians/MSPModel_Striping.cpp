@@ -109,7 +109,8 @@ const double MSPModel_Striping::MIN_STARTUP_DIST(0.4); // meters
 // ===========================================================================
 
 MSPModel_Striping::MSPModel_Striping(const OptionsCont& oc, MSNet* net) :
-    myNumActivePedestrians(0) {
+    myNumActivePedestrians(0),
+    myLaneBuffers(1) {
     net->getBeginOfTimestepEvents()->addEvent(new MovePedestrians(this), net->getCurrentTimeStep() + DELTA_T);
     initWalkingAreaPaths(net);
     // configurable parameters
@@ -120,6 +121,11 @@ MSPModel_Striping::MSPModel_Striping(const OptionsCont& oc, MSNet* net) :
     if (jamTime <= 0) {
         jamTime = SUMOTime_MAX;
     }
+#ifdef HAVE_FOX
+    while (myThreadPool.size() < oc.getInt("pedestrian.striping.threads")) {
+        new FXWorkerThread(myThreadPool);
+    }
+#endif
 }
 
 
@@ -258,6 +264,17 @@ MSPModel_Striping::getPedestrians(const MSLane* lane) {
 }
 
 
+MSPModel_Striping::Pedestrians&
+MSPModel_Striping::getSnapshot(const MSLane* lane, int dir) {
+    LaneSnapshots::iterator it = mySnapshots.find(lane);
+    if (it != mySnapshots.end()) {
+        return dir == FORWARD ? it->second.forward : it->second.backward;
+    } else {
+        return noPedestrians;
+    }
+}
+
+
 void
 MSPModel_Striping::cleanupHelper() {
     myActiveLanes.clear();
@@ -548,43 +565,53 @@ MSPModel_Striping::getNextWalkingArea(const MSLane* currentLane, const int dir,
 }
 
 
-MSPModel_Striping::Obstacles
-MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes) {
+void
+MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes, LaneBuffers& buffers) {
     const PState& ego = *pedestrians[egoIndex];
-    Obstacles obs(stripes, Obstacle(ego.myDir));
-    std::vector<bool> haveBlocker(stripes, false);
-    for (int index = egoIndex + 1; index < (int)pedestrians.size(); index++) {
+    const std::vector<int>& nextEntered = buffers.nextEntered;
+    Obstacles& obs = buffers.neighObs;
+    std::vector<bool>& haveBlocker = buffers.haveBlocker;
+    obs.assign(stripes, Obstacle(ego.myDir));
+    haveBlocker.assign(stripes, false);
+    // pedestrians waiting to enter are skipped without looking at them
+    for (int index = nextEntered[egoIndex + 1]; index < (int)pedestrians.size(); index = nextEntered[index + 1]) {
         const PState& p = *pedestrians[index];
         if DEBUGCOND(ego) {
             std::cout << SIMTIME << " ped=" << ego.myPerson->getID() << "  checking neighbor " << p.myPerson->getID();
         }
-        if (!p.myWaitingToEnter) {
-            const Obstacle o(p);
-            if DEBUGCOND(ego) {
-                std::cout << " dist=" << ego.distanceTo(o) << std::endl;
-            }
-            if (ego.distanceTo(o) == DIST_BEHIND) {
-                break;
-            }
-            if (ego.distanceTo(o) == DIST_OVERLAP) {
-                obs[p.stripe()] = o;
-                obs[p.otherStripe()] = o;
-                haveBlocker[p.stripe()] = true;
-                haveBlocker[p.otherStripe()] = true;
-            }
-            if (!haveBlocker[p.stripe()]) {
-                obs[p.stripe()] = o;
-            }
-            if (!haveBlocker[p.otherStripe()]) {
-                obs[p.otherStripe()] = o;
-            }
+        const Obstacle o(p);
+        if DEBUGCOND(ego) {
+            std::cout << " dist=" << ego.distanceTo(o) << std::endl;
+        }
+        if (ego.distanceTo(o) == DIST_BEHIND) {
+            break;
+        }
+        if (ego.distanceTo(o) == DIST_OVERLAP) {
+            obs[p.stripe()] = o;
+            obs[p.otherStripe()] = o;
+            haveBlocker[p.stripe()] = true;
+            haveBlocker[p.otherStripe()] = true;
+        }
+        if (!haveBlocker[p.stripe()]) {
+            obs[p.stripe()] = o;
+        }
+        if (!haveBlocker[p.otherStripe()]) {
+            obs[p.otherStripe()] = o;
         }
     }
     if DEBUGCOND(ego) {
         std::cout << SIMTIME << " ped=" << ego.myPerson->getID() << "  neighObs=";
         DEBUG_PRINT(obs);
     }
-    return obs;
+}
+
+
+void
+MSPModel_Striping::addStripeMember(std::vector<std::vector<int> >& stripeMembers, const PState& p, int index) {
+    stripeMembers[p.stripe()].push_back(index);
+    if (p.otherStripe() != p.stripe()) {
+        stripeMembers[p.otherStripe()].push_back(index);
+    }
 }
 
 
@@ -601,9 +628,10 @@ MSPModel_Striping::getStripeOffset(int origStripes, int destStripes, bool addRem
 const MSPModel_Striping::Obstacles&
 MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
                                         MSLane* lane, const MSLane* nextLane, int stripes, int nextDir,
-                                        double currentLength, int currentDir) {
+                                        double currentLength, int currentDir, bool useSnapshots) {
     if (nextLanesObs.count(nextLane) == 0) {
-        const double nextLength = nextLane->getEdge().isWalkingArea() ? myMinNextLengths[nextLane] : nextLane->getLength();
+        // the lengths are filled on construction, inserting here would modify the map from the worker threads
+        const double nextLength = nextLane->getEdge().isWalkingArea() ? myMinNextLengths.at(nextLane) : nextLane->getLength();
         // figure out the which pedestrians are ahead on the next lane
         const int nextStripes = numStripes(nextLane);
         // do not move past the end of the next lane in a single step
@@ -628,7 +656,7 @@ MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
                 }
             }
         }
-        Pedestrians& pedestrians = getPedestrians(nextLane);
+        Pedestrians& pedestrians = useSnapshots ? getSnapshot(nextLane, nextDir) : getPedestrians(nextLane);
         if (nextLane->getEdge().isWalkingArea()) {
             transformToCurrentLanePositions(obs, currentDir, nextDir, currentLength, nextLength);
             // complex transformation into the coordinate system of the current lane
@@ -656,7 +684,10 @@ MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
             // simple transformation into the coordinate system of the current lane
             // (only need to worry about currentDir and nextDir)
             // XXX consider waitingToEnter on nextLane
-            sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(nextDir));
+            if (!useSnapshots) {
+                // snapshots are already sorted (and shared between threads)
+                sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(nextDir));
+            }
             for (int ii = 0; ii < (int)pedestrians.size(); ++ii) {
                 const PState& p = *pedestrians[ii];
                 if (p.myWaitingToEnter || p.myAmJammed) {
@@ -731,84 +762,163 @@ MSPModel_Striping::addCloserObstacle(Obstacles& obs, double x, int stripe, int n
 
 void
 MSPModel_Striping::moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        moveInDirectionParallel(currentTime, changedLane, dir);
+        return;
+    }
+#endif
+    for (ActiveLanes::iterator it_lane = myActiveLanes.begin(); it_lane != myActiveLanes.end(); ++it_lane) {
+        if (it_lane->second.size() > 0) {
+            moveLane(it_lane->first, it_lane->second, myLaneBuffers.front(), currentTime, changedLane, dir);
+        }
+    }
+}
+
+
+void
+MSPModel_Striping::moveInDirectionParallel(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+#ifdef HAVE_FOX
+    // collect the lanes and copy the states which other lanes use as obstacles
+    std::vector<std::pair<const MSLane*, Pedestrians*> > lanes;
+    mySnapshots.clear();
     for (ActiveLanes::iterator it_lane = myActiveLanes.begin(); it_lane != myActiveLanes.end(); ++it_lane) {
-        const MSLane* lane = it_lane->first;
         Pedestrians& pedestrians = it_lane->second;
         if (pedestrians.size() == 0) {
             continue;
         }
-        //std::cout << SIMTIME << ">>> lane=" << lane->getID() << " numPeds=" << pedestrians.size() << "\n";
-        if (lane->getEdge().isWalkingArea()) {
-            const double lateral_offset = (lane->getWidth() - stripeWidth) * 0.5;
-            const double minY = stripeWidth * - 0.5 + NUMERICAL_EPS;
-            const double maxY = stripeWidth * (numStripes(lane) - 0.5) - NUMERICAL_EPS;
-            const WalkingAreaPath* debugPath = 0;
-            // need to handle each walkingAreaPath seperately and transform
-            // coordinates beforehand
-            std::set<const WalkingAreaPath*, walkingarea_path_sorter> paths;
-            for (Pedestrians::iterator it = pedestrians.begin(); it != pedestrians.end(); ++it) {
-                const PState* p = *it;
-                assert(p->myWalkingAreaPath != 0);
-                if (p->myDir == dir) {
-                    paths.insert(p->myWalkingAreaPath);
-                    if DEBUGCOND(*p) {
-                        debugPath = p->myWalkingAreaPath;
-                        std::cout << SIMTIME << " debugging WalkingAreaPath from=" << debugPath->from->getID() << " to=" << debugPath->to->getID() << "\n";
-                    }
+        lanes.push_back(std::make_pair(it_lane->first, &pedestrians));
+        LaneSnapshot& snapshot = mySnapshots[it_lane->first];
+        snapshot.states.reserve(pedestrians.size());
+        for (Pedestrians::const_iterator it = pedestrians.begin(); it != pedestrians.end(); ++it) {
+            snapshot.states.push_back(**it);
+        }
+        for (std::vector<PState>::iterator it = snapshot.states.begin(); it != snapshot.states.end(); ++it) {
+            snapshot.forward.push_back(&*it);
+        }
+        snapshot.backward = snapshot.forward;
+        sort(snapshot.forward.begin(), snapshot.forward.end(), by_xpos_sorter(FORWARD));
+        sort(snapshot.backward.begin(), snapshot.backward.end(), by_xpos_sorter(BACKWARD));
+    }
+    // move all lanes concurrently, seeding the random numbers in lane order
+    std::vector<LaneUpdate> updates(lanes.size());
+    if (myLaneBuffers.size() < lanes.size()) {
+        myLaneBuffers.resize(lanes.size());
+    }
+    for (int i = 0; i < (int)lanes.size(); i++) {
+        updates[i].rng.seed(RandHelper::rand(std::numeric_limits<int>::max()));
+        updates[i].numJammed = 0;
+        myThreadPool.add(new MoveLaneTask(this, lanes[i].first, *lanes[i].second, updates[i], myLaneBuffers[i], currentTime, changedLane, dir));
+    }
+    myThreadPool.waitAll();
+    mySnapshots.clear();
+    // apply the deferred updates in lane order
+    for (int i = 0; i < (int)lanes.size(); i++) {
+        LaneUpdate& update = updates[i];
+        for (Pedestrians::iterator it = update.reroute.begin(); it != update.reroute.end(); ++it) {
+            PState* const p = *it;
+            p->myNLI = getNextLane(*p, p->myLane, p->myWalkingAreaPath->from);
+        }
+        for (int j = 0; j < update.numJammed; j++) {
+            MSNet::getInstance()->getPersonControl().registerJammed();
+        }
+        for (std::vector<std::string>::const_iterator it = update.warnings.begin(); it != update.warnings.end(); ++it) {
+            WRITE_WARNING(*it);
+        }
+        for (Pedestrians::iterator it = update.arrived.begin(); it != update.arrived.end(); ++it) {
+            advance(*it, currentTime, changedLane);
+        }
+    }
+#else
+    UNUSED_PARAMETER(currentTime);
+    UNUSED_PARAMETER(changedLane);
+    UNUSED_PARAMETER(dir);
+#endif
+}
+
+
+void
+MSPModel_Striping::moveLane(const MSLane* lane, Pedestrians& pedestrians, LaneBuffers& buffers, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, LaneUpdate* update) {
+    //std::cout << SIMTIME << ">>> lane=" << lane->getID() << " numPeds=" << pedestrians.size() << "\n";
+    if (lane->getEdge().isWalkingArea()) {
+        const double lateral_offset = (lane->getWidth() - stripeWidth) * 0.5;
+        const double minY = stripeWidth * - 0.5 + NUMERICAL_EPS;
+        const double maxY = stripeWidth * (numStripes(lane) - 0.5) - NUMERICAL_EPS;
+        // the maximum lateral distance to a path of pedestrians which may be obstacles on it
+        const double maxLateral = MAX2(fabs(minY - lateral_offset), fabs(maxY - lateral_offset)) + NUMERICAL_EPS;
+        const WalkingAreaPath* debugPath = 0;
+        // need to handle each walkingAreaPath seperately and transform
+        // coordinates beforehand
+        std::set<const WalkingAreaPath*, walkingarea_path_sorter> paths;
+        for (Pedestrians::iterator it = pedestrians.begin(); it != pedestrians.end(); ++it) {
+            const PState* p = *it;
+            assert(p->myWalkingAreaPath != 0);
+            if (p->myDir == dir) {
+                paths.insert(p->myWalkingAreaPath);
+                if DEBUGCOND(*p) {
+                    debugPath = p->myWalkingAreaPath;
+                    std::cout << SIMTIME << " debugging WalkingAreaPath from=" << debugPath->from->getID() << " to=" << debugPath->to->getID() << "\n";
                 }
             }
-            for (std::set<const WalkingAreaPath*, walkingarea_path_sorter>::iterator it = paths.begin(); it != paths.end(); ++it) {
-                const WalkingAreaPath* path = *it;
-                Pedestrians toDelete;
-                Pedestrians transformedPeds;
-                transformedPeds.reserve(pedestrians.size());
-                for (Pedestrians::iterator it_p = pedestrians.begin(); it_p != pedestrians.end(); ++it_p) {
-                    PState* p = *it_p;
-                    if (p->myWalkingAreaPath == path
-                            // opposite direction is already in the correct coordinate system
-                            || (p->myWalkingAreaPath->from == path->to && p->myWalkingAreaPath->to == path->from)) {
-                        transformedPeds.push_back(p);
-                        if (path == debugPath) std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << p->myRelX << " relY=" << p->myRelY << " (untransformed), vecCoord="
-                                                             << path->shape.transformToVectorCoordinates(p->getPosition(*p->myStage, -1)) << "\n";
+        }
+        for (std::set<const WalkingAreaPath*, walkingarea_path_sorter>::iterator it = paths.begin(); it != paths.end(); ++it) {
+            const WalkingAreaPath* path = *it;
+            Pedestrians toDelete;
+            Pedestrians transformedPeds;
+            transformedPeds.reserve(pedestrians.size());
+            for (Pedestrians::iterator it_p = pedestrians.begin(); it_p != pedestrians.end(); ++it_p) {
+                PState* p = *it_p;
+                if (p->myWalkingAreaPath == path
+                        // opposite direction is already in the correct coordinate system
+                        || (p->myWalkingAreaPath->from == path->to && p->myWalkingAreaPath->to == path->from)) {
+                    transformedPeds.push_back(p);
+                    if (path == debugPath) std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << p->myRelX << " relY=" << p->myRelY << " (untransformed), vecCoord="
+                                                         << path->shape.transformToVectorCoordinates(p->getPosition(*p->myStage, -1)) << "\n";
+                } else {
+                    const Position pos = p->getPosition(*p->myStage, -1);
+                    const Boundary& b = path->bounds;
+                    if (pos.x() < b.xmin() - maxLateral || pos.x() > b.xmax() + maxLateral
+                            || pos.y() < b.ymin() - maxLateral || pos.y() > b.ymax() + maxLateral) {
+                        // too far from the path to be within its lateral range, skip the expensive transformation
+                        continue;
+                    }
+                    const Position relPos = path->shape.transformToVectorCoordinates(pos);
+                    const double newY = relPos.y() + lateral_offset;
+                    if (relPos != Position::INVALID && newY >= minY && newY <= maxY) {
+                        PState* tp = new PState(*p);
+                        tp->myRelX = relPos.x();
+                        tp->myRelY = newY;
+                        // only an obstacle, speed may be orthogonal to dir
+                        tp->myDir = !dir;
+                        tp->mySpeed = 0;
+                        toDelete.push_back(tp);
+                        transformedPeds.push_back(tp);
+                        if (path == debugPath) {
+                            std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (transformed), vecCoord=" << relPos << "\n";
+                        }
                     } else {
-                        const Position relPos = path->shape.transformToVectorCoordinates(p->getPosition(*p->myStage, -1));
-                        const double newY = relPos.y() + lateral_offset;
-                        if (relPos != Position::INVALID && newY >= minY && newY <= maxY) {
-                            PState* tp = new PState(*p);
-                            tp->myRelX = relPos.x();
-                            tp->myRelY = newY;
-                            // only an obstacle, speed may be orthogonal to dir
-                            tp->myDir = !dir;
-                            tp->mySpeed = 0;
-                            toDelete.push_back(tp);
-                            transformedPeds.push_back(tp);
-                            if (path == debugPath) {
-                                std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (transformed), vecCoord=" << relPos << "\n";
-                            }
-                        } else {
-                            if (path == debugPath) {
-                                std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (invalid), vecCoord=" << relPos << "\n";
-                            }
+                        if (path == debugPath) {
+                            std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (invalid), vecCoord=" << relPos << "\n";
                         }
                     }
                 }
-                moveInDirectionOnLane(transformedPeds, lane, currentTime, changedLane, dir);
-                arriveAndAdvance(pedestrians, currentTime, changedLane, dir);
-                // clean up
-                for (Pedestrians::iterator it_p = toDelete.begin(); it_p != toDelete.end(); ++it_p) {
-                    delete *it_p;
-                }
             }
-        } else {
-            moveInDirectionOnLane(pedestrians, lane, currentTime, changedLane, dir);
-            arriveAndAdvance(pedestrians, currentTime, changedLane, dir);
+            moveInDirectionOnLane(transformedPeds, lane, buffers, currentTime, changedLane, dir, update);
+            arriveAndAdvance(pedestrians, currentTime, changedLane, dir, update);
+            // clean up
+            for (Pedestrians::iterator it_p = toDelete.begin(); it_p != toDelete.end(); ++it_p) {
+                delete *it_p;
+            }
         }
+    } else {
+        moveInDirectionOnLane(pedestrians, lane, buffers, currentTime, changedLane, dir, update);
+        arriveAndAdvance(pedestrians, currentTime, changedLane, dir, update);
     }
 }
 
 
 void
-MSPModel_Striping::arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+MSPModel_Striping::arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, LaneUpdate* update) {
     // advance to the next lane / arrive at destination
     sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(dir));
     // can't use iterators because we do concurrent modification
@@ -819,14 +929,10 @@ MSPModel_Striping::arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTi
             // walks) so erase must be called first
             pedestrians.erase(pedestrians.begin() + i);
             i--;
-            p->moveToNextLane(currentTime);
-            if (p->myLane != 0) {
-                changedLane.insert(p->myPerson);
-                myActiveLanes[p->myLane].push_back(p);
+            if (update != 0) {
+                update->arrived.push_back(p);
             } else {
-                // end walking stage and destroy PState
-                p->myStage->moveToNextEdge(p->myPerson, currentTime);
-                myNumActivePedestrians--;
+                advance(p, currentTime, changedLane);
             }
         }
     }
@@ -834,23 +940,62 @@ MSPModel_Striping::arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTi
 
 
 void
-MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+MSPModel_Striping::advance(PState* p, SUMOTime currentTime, std::set<MSPerson*>& changedLane) {
+    p->moveToNextLane(currentTime);
+    if (p->myLane != 0) {
+        changedLane.insert(p->myPerson);
+        myActiveLanes[p->myLane].push_back(p);
+    } else {
+        // end walking stage and destroy PState
+        p->myStage->moveToNextEdge(p->myPerson, currentTime);
+        myNumActivePedestrians--;
+    }
+}
+
+
+void
+MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, LaneBuffers& buffers, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, LaneUpdate* update) {
     const int stripes = numStripes(lane);
     //std::cout << " laneWidth=" << lane->getWidth() << " stripeWidth=" << stripeWidth << " stripes=" << stripes << "\n";
     Obstacles obs(stripes, Obstacle(dir)); // continously updated
     NextLanesObstacles nextLanesObs; // continously updated
     sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(dir));
 
+    // the waiting state of the pedestrians ahead in the list does not change while moving
+    std::vector<int>& nextEntered = buffers.nextEntered;
+    nextEntered.assign(pedestrians.size() + 1, (int)pedestrians.size());
+    for (int ii = (int)pedestrians.size() - 1; ii >= 0; --ii) {
+        nextEntered[ii] = pedestrians[ii]->myWaitingToEnter ? nextEntered[ii + 1] : ii;
+    }
+
     Obstacles crossingVehs(stripes, Obstacle(dir));
     bool hasCrossingVehObs = false;
     if (lane->getEdge().isCrossing()) {
         hasCrossingVehObs = addCrossingVehs(lane, stripes, 0, dir, crossingVehs);
     }
 
+    // vehicles do not move while the pedestrians do
+    const bool hasVehicles = lane->getVehicleNumberWithPartials() > 0;
+    if (hasVehicles) {
+        collectVehicles(lane, dir, buffers.vehicles);
+    }
+
+    // pedestrians ahead in the list keep their position once handled, only those sharing a stripe may collide
+    std::vector<std::vector<int> >& stripeMembers = buffers.stripeMembers;
+    if (MSGlobals::gCheck4Accidents) {
+        if ((int)stripeMembers.size() < stripes) {
+            stripeMembers.resize(stripes);
+        }
+        for (int s = 0; s < stripes; ++s) {
+            stripeMembers[s].clear();
+        }
+    }
+
+    Obstacles& currentObs = buffers.currentObs;
     for (int ii = 0; ii < (int)pedestrians.size(); ++ii) {
         PState& p = *pedestrians[ii];
         //std::cout << SIMTIME << "CHECKING" << p.myPerson->getID() << "\n";
-        Obstacles currentObs = obs;
+        currentObs = obs;
         if (p.myDir != dir || changedLane.count(p.myPerson) != 0) {
             if (!p.myWaitingToEnter) {
                 //if DEBUGCOND(p) {
@@ -863,12 +1008,19 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
                 }
                 obs[p.stripe()] = o;
                 obs[p.otherStripe()] = o;
+                if (MSGlobals::gCheck4Accidents && p.myWalkingAreaPath == 0 && !p.myAmJammed) {
+                    addStripeMember(stripeMembers, p, ii);
+                }
             }
             continue;
         }
+        // the global debug flag must not be written by the worker threads
+        const bool setDebugFlag = update == 0 && DEBUGCOND(p);
         if DEBUGCOND(p) {
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  currentObs=";
-            gDebugFlag1 = true;
+            if (setDebugFlag) {
+                gDebugFlag1 = true;
+            }
             DEBUG_PRINT(currentObs);
         }
         const MSLane* nextLane = p.myNLI.lane;
@@ -879,7 +1031,7 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             const double currentLength = (p.myWalkingAreaPath == 0 ? lane->getLength() : p.myWalkingAreaPath->length);
             const Obstacles& nextObs = getNextLaneObstacles(
                                            nextLanesObs, lane, nextLane, stripes,
-                                           p.myNLI.dir, currentLength, dir);
+                                           p.myNLI.dir, currentLength, dir, update != 0);
 
             if DEBUGCOND(p) {
                 std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  nextObs=";
@@ -891,7 +1043,8 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithNext=";
             DEBUG_PRINT(currentObs);
         }
-        p.mergeObstacles(currentObs, getNeighboringObstacles(pedestrians, ii, stripes));
+        getNeighboringObstacles(pedestrians, ii, stripes, buffers);
+        p.mergeObstacles(currentObs, buffers.neighObs);
         if DEBUGCOND(p) {
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithNeigh=";
             DEBUG_PRINT(currentObs);
@@ -901,11 +1054,15 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
         const double passingLength = p.getLength() + passingClearanceTime * speed;
         // check link state
         if DEBUGCOND(p) {
-            gDebugFlag1 = true;
+            if (setDebugFlag) {
+                gDebugFlag1 = true;
+            }
             std::cout << "   link=" << (link == nullptr ? "NULL" : link->getViaLaneOrLane()->getID()) 
                 << " dist=" << dist << " d2=" << dist -p.getMinGap() << " la=" << LOOKAHEAD_SAMEDIR * speed 
                 << " opened=" << link->opened(currentTime - DELTA_T, speed, speed, passingLength, p.getImpatience(currentTime), speed, 0, 0, 0, p.ignoreRed(link)) << "\n";
-            gDebugFlag1 = false;
+            if (setDebugFlag) {
+                gDebugFlag1 = false;
+            }
         }
         if (link != 0
                 // only check close before junction, @todo we should take deceleration into account here
@@ -922,7 +1079,12 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             // consider rerouting over another crossing
             if (p.myWalkingAreaPath != 0) {
                 // @todo actually another path would be needed starting at the current position
-                p.myNLI = getNextLane(p, p.myLane, p.myWalkingAreaPath->from);
+                if (update != 0) {
+                    // routing is not thread safe
+                    update->reroute.push_back(&p);
+                } else {
+                    p.myNLI = getNextLane(p, p.myLane, p.myWalkingAreaPath->from);
+                }
             }
         }
         if (&lane->getEdge() == &p.myStage->getDestination() && p.myStage->getDestinationStop() != 0) {
@@ -930,10 +1092,9 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             p.mergeObstacles(currentObs, arrival);
         }
 
-        if (lane->getVehicleNumberWithPartials() > 0) {
+        if (hasVehicles) {
             // react to vehicles on the same lane
-            // @todo: improve efficiency by using the same iterator for all pedestrians on this lane
-            Obstacles vehObs = getVehicleObstacles(lane, dir, &p);
+            Obstacles vehObs = getVehicleObstacles(lane, dir, buffers.vehicles, &p);
             p.mergeObstacles(currentObs, vehObs);
             if DEBUGCOND(p) {
                 std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithVehs=";
@@ -949,26 +1110,44 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
         }
 
         // walk, taking into account all obstacles
-        p.walk(currentObs, currentTime);
-        gDebugFlag1 = false;
+        p.walk(currentObs, currentTime, update);
+        if (setDebugFlag) {
+            gDebugFlag1 = false;
+        }
         if (!p.myWaitingToEnter && !p.myAmJammed) {
             Obstacle o(p);
             obs[p.stripe()] = o;
             obs[p.otherStripe()] = o;
             if (MSGlobals::gCheck4Accidents && p.myWalkingAreaPath == 0 && !p.myAmJammed) {
-                for (int coll = 0; coll < ii; ++coll) {
+                // merge the members of both stripes of p in list order, skipping those found in both
+                const std::vector<int>& members = stripeMembers[p.stripe()];
+                const std::vector<int>& otherMembers = p.otherStripe() == p.stripe() ? members : stripeMembers[p.otherStripe()];
+                std::vector<int>::const_iterator it = members.begin();
+                std::vector<int>::const_iterator it_other = otherMembers.begin();
+                while (it != members.end() || it_other != otherMembers.end()) {
+                    int coll;
+                    if (it_other == otherMembers.end() || (it != members.end() && *it < *it_other)) {
+                        coll = *it++;
+                    } else {
+                        if (it != members.end() && *it == *it_other) {
+                            ++it;
+                        }
+                        coll = *it_other++;
+                    }
                     PState& c = *pedestrians[coll];
-                    if (!c.myWaitingToEnter && c.myWalkingAreaPath == 0 && !c.myAmJammed) {
-                        if (c.stripe() == p.stripe() || p.stripe() == c.otherStripe() || p.otherStripe() == c.stripe() || p.otherStripe() == c.otherStripe()) {
-                            Obstacle cObs(c);
-                            // we check only for real collisions, no min gap violations
-                            if (p.distanceTo(cObs, false) == DIST_OVERLAP) {
-                                WRITE_WARNING("Collision of person '" + p.myPerson->getID() + "' and person '" + c.myPerson->getID()
-                                              + "', lane='" + lane->getID() + "', time=" + time2string(currentTime) + ".");
-                            }
+                    Obstacle cObs(c);
+                    // we check only for real collisions, no min gap violations
+                    if (p.distanceTo(cObs, false) == DIST_OVERLAP) {
+                        const std::string msg = "Collision of person '" + p.myPerson->getID() + "' and person '" + c.myPerson->getID()
+                                                + "', lane='" + lane->getID() + "', time=" + time2string(currentTime) + ".";
+                        if (update != 0) {
+                            update->warnings.push_back(msg);
+                        } else {
+                            WRITE_WARNING(msg);
                         }
                     }
                 }
+                addStripeMember(stripeMembers, p, ii);
             }
         }
         //std::cout << SIMTIME << p.myPerson->getID() << " lane=" << lane->getID() << " x=" << p.myRelX << "\n";
@@ -1031,8 +1210,43 @@ MSPModel_Striping::addCrossingVehs(const MSLane* crossing, int stripes, double l
 }
 
 
-MSPModel_Striping::Obstacles 
+MSPModel_Striping::Obstacles
 MSPModel_Striping::getVehicleObstacles(const MSLane* lane, int dir, PState* ped) {
+    LaneVehicles vehicles;
+    collectVehicles(lane, dir, vehicles);
+    return getVehicleObstacles(lane, dir, vehicles, ped);
+}
+
+
+void
+MSPModel_Striping::collectVehicles(const MSLane* lane, int dir, LaneVehicles& into) {
+    into.vehicles.clear();
+    into.byBack.clear();
+    into.maxReach = 0.;
+    MSLane::AnyVehicleIterator begin = (dir == FORWARD ? lane->anyVehiclesUpstreamBegin() : lane->anyVehiclesBegin());
+    MSLane::AnyVehicleIterator end = (dir == FORWARD ? lane->anyVehiclesUpstreamEnd() : lane->anyVehiclesEnd());
+    for (MSLane::AnyVehicleIterator it = begin; it != end; ++it) {
+        VehicleObstacle v;
+        v.veh = *it;
+        v.back = v.veh->getBackPositionOnLane(lane);
+        v.front = v.back + v.veh->getVehicleType().getLength();
+        // ensure that vehicles are not blocked
+        const double vehNextSpeed = MAX2(v.veh->getSpeed(), 1.0);
+        v.clearance = SAFETY_GAP + vehNextSpeed * LOOKAHEAD_SAMEDIR;
+        // relY increases from left to right (the other way around from vehicles)
+        // XXX lateral offset for partial vehicles
+        v.yMax = 0.5 * (lane->getWidth() + v.veh->getVehicleType().getWidth() - stripeWidth) - v.veh->getLateralPositionOnLane();
+        v.yMin = v.yMax - v.veh->getVehicleType().getWidth();
+        into.maxReach = MAX2(into.maxReach, v.front - v.back + v.clearance);
+        into.byBack.push_back(std::make_pair(v.back, (int)into.vehicles.size()));
+        into.vehicles.push_back(v);
+    }
+    std::sort(into.byBack.begin(), into.byBack.end());
+}
+
+
+MSPModel_Striping::Obstacles
+MSPModel_Striping::getVehicleObstacles(const MSLane* lane, int dir, const LaneVehicles& vehicles, PState* ped) {
     const int stripes = numStripes(lane);
     Obstacles vehObs(stripes, Obstacle(dir));
     int current = -1;
@@ -1055,25 +1269,30 @@ MSPModel_Striping::getVehicleObstacles(const MSLane* lane, int dir, PState* ped)
         minX = lane->getLength();
         maxX = lane->getLength();
     }
-    MSLane::AnyVehicleIterator begin = (dir == FORWARD ? lane->anyVehiclesUpstreamBegin() : lane->anyVehiclesBegin());
-    MSLane::AnyVehicleIterator end = (dir == FORWARD ? lane->anyVehiclesUpstreamEnd() : lane->anyVehiclesEnd());
-    for (MSLane::AnyVehicleIterator it = begin; it != end; ++it) {
-        const MSVehicle* veh = *it;
-        const double vehBack = veh->getBackPositionOnLane(lane);
-        const double vehFront = vehBack + veh->getVehicleType().getLength();
-        // ensure that vehicles are not blocked
-        const double vehNextSpeed = MAX2(veh->getSpeed(), 1.0);
-        const double clearance = SAFETY_GAP + vehNextSpeed * LOOKAHEAD_SAMEDIR;
+    // only the vehicles whose back is within this (generous) range may be relevant
+    const double rangeBegin = minX - vehicles.maxReach - (dir == FORWARD ? 0. : LOOKAROUND_VEHICLES) - 1.;
+    const double rangeEnd = maxX + (dir == FORWARD ? LOOKAHEAD_SAMEDIR : 0.) + 1.;
+    std::vector<int> candidates;
+    for (std::vector<std::pair<double, int> >::const_iterator it = std::lower_bound(vehicles.byBack.begin(), vehicles.byBack.end(), std::make_pair(rangeBegin, -1));
+            it != vehicles.byBack.end() && it->first <= rangeEnd; ++it) {
+        candidates.push_back(it->second);
+    }
+    // later vehicles overwrite earlier ones so keep the order of the lane iterator
+    std::sort(candidates.begin(), candidates.end());
+    for (std::vector<int>::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+        const VehicleObstacle& v = vehicles.vehicles[*it];
+        const MSVehicle* veh = v.veh;
+        const double vehBack = v.back;
+        const double vehFront = v.front;
+        const double clearance = v.clearance;
         if ((dir == FORWARD && vehFront + clearance > minX && vehBack <= maxX + LOOKAHEAD_SAMEDIR)
                 || (dir == BACKWARD && vehBack < maxX && vehFront >= minX - LOOKAROUND_VEHICLES)) {
             Obstacle vo(vehBack, veh->getSpeed(), OBSTACLE_VEHICLE, veh->getID(), 0);
             // moving vehicles block space along their path
             vo.xFwd += veh->getVehicleType().getLength() + clearance;
             vo.xBack -= SAFETY_GAP;
-            // relY increases from left to right (the other way around from vehicles)
-            // XXX lateral offset for partial vehicles
-            const double vehYmax = 0.5 * (lane->getWidth() + veh->getVehicleType().getWidth() - stripeWidth) - veh->getLateralPositionOnLane();
-            const double vehYmin = vehYmax - veh->getVehicleType().getWidth();
+            const double vehYmax = v.yMax;
+            const double vehYmin = v.yMin;
             for (int s = MAX2(0, PState::stripe(vehYmin)); s < MIN2(PState::stripe(vehYmax) + 1, stripes); ++s) {
                 vehObs[s] = vo;
                 if (s == current && vehFront + SAFETY_GAP < minX) {
@@ -1403,7 +1622,7 @@ MSPModel_Striping::PState::moveToNextLane(SUMOTime currentTime) {
 
 
 void
-MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime) {
+MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime, LaneUpdate* update) {
     const int stripes = (int)obs.size();
     const int sMax =  stripes - 1;
     assert(stripes == numStripes(myLane));
@@ -1521,10 +1740,16 @@ MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime) {
         if (myWaitingTime > jamTime || myAmJammed) {
             // squeeze slowly through the crowd ignoring others
             if (!myAmJammed) {
-                MSNet::getInstance()->getPersonControl().registerJammed();
-                WRITE_WARNING("Person '" + myPerson->getID()
-                              + "' is jammed on edge '" + myStage->getEdge()->getID()
-                              + "', time=" + time2string(MSNet::getInstance()->getCurrentTimeStep()) + ".");
+                const std::string msg = "Person '" + myPerson->getID()
+                                        + "' is jammed on edge '" + myStage->getEdge()->getID()
+                                        + "', time=" + time2string(MSNet::getInstance()->getCurrentTimeStep()) + ".";
+                if (update != 0) {
+                    update->numJammed++;
+                    update->warnings.push_back(msg);
+                } else {
+                    MSNet::getInstance()->getPersonControl().registerJammed();
+                    WRITE_WARNING(msg);
+                }
                 myAmJammed = true;
             }
             xSpeed = vMax / 4;
@@ -1533,7 +1758,7 @@ MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime) {
         myAmJammed = false;
     }
     // dawdling
-    const double dawdle = MIN2(xSpeed, RandHelper::rand() * vMax * dawdling);
+    const double dawdle = MIN2(xSpeed, RandHelper::rand(update != 0 ? &update->rng : 0) * vMax * dawdling);
     xSpeed -= dawdle;
 
     // XXX ensure that diagonal speed <= vMax
@@ -1781,6 +2006,14 @@ MSPModel_Striping::PState::ignoreRed(const MSLink* link) const {
 // ===========================================================================
 //
 
+#ifdef HAVE_FOX
+void
+MSPModel_Striping::MoveLaneTask::run(FXWorkerThread* /* context */) {
+    myModel->moveLane(myLane, myPedestrians, myBuffers, myTime, myChangedLane, myDir, &myUpdate);
+}
+#endif
+
+
 SUMOTime
 MSPModel_Striping::MovePedestrians::execute(SUMOTime currentTime) {
     std::set<MSPerson*> changedLane;
@@ -29,13 +29,19 @@
 
 #include <string>
 #include <limits>
+#include <random>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/Command.h>
 #include <utils/options/OptionsCont.h>
+#include <utils/geom/Boundary.h>
 #include <microsim/MSLane.h>
 #include "MSPerson.h"
 #include "MSPModel.h"
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
 // ===========================================================================
 // class declarations
 // ===========================================================================
@@ -161,6 +167,8 @@ protected:
     struct Obstacle;
     struct WalkingAreaPath;
     class PState;
+    struct LaneUpdate;
+    struct LaneVehicles;
     typedef std::vector<PState*> Pedestrians;
     typedef std::map<const MSLane*, Pedestrians, lane_by_numid_sorter> ActiveLanes;
     typedef std::vector<Obstacle> Obstacles;
@@ -227,7 +235,8 @@ protected:
             to(_to),
             lane(_walkingArea),
             shape(_shape),
-            length(_shape.length()) {
+            length(_shape.length()),
+            bounds(_shape.getBoxBoundary()) {
         }
 
         WalkingAreaPath(): from(0), to(0), lane(0) {};
@@ -237,6 +246,8 @@ protected:
         const MSLane* lane; // the walkingArea;
         PositionVector shape; // actually const but needs to be copyable by some stl code
         double length;
+        /// @brief the bounding box of the shape for quickly discarding far away pedestrians
+        Boundary bounds;
 
     };
 
@@ -322,8 +333,12 @@ protected:
         /// @brief return whether this pedestrian has passed the end of the current lane and update myRelX if so
         bool moveToNextLane(SUMOTime currentTime);
 
-        /// @brief perform position update
-        void walk(const Obstacles& obs, SUMOTime currentTime);
+        /** @brief perform position update
+         * @param[in] obs The obstacles to take into account
+         * @param[in] currentTime The current simulation time
+         * @param[in] update The results of a lane moved in parallel (0 when moving sequentially)
+         */
+        void walk(const Obstacles& obs, SUMOTime currentTime, LaneUpdate* update = 0);
 
         /// @brief returns the impatience
         double getImpatience(SUMOTime now) const;
@@ -352,6 +367,117 @@ protected:
         bool ignoreRed(const MSLink* link) const;
     };
 
+    /**
+     * @struct LaneUpdate
+     * @brief The random numbers and the deferred effects of moving a single lane in parallel
+     *
+     * Everything touching the state beyond the lane (advancing to other lanes, routing,
+     *  messages and counters) is collected while moving and applied afterwards in lane order.
+     */
+    struct LaneUpdate {
+        /// @brief the random number generator for dawdling
+        std::mt19937 rng;
+        /// @brief the pedestrians which passed the end of the lane, in the order of detection
+        Pedestrians arrived;
+        /// @brief the pedestrians which look for another path across the junction
+        Pedestrians reroute;
+        /// @brief the number of newly jammed pedestrians
+        int numJammed;
+        /// @brief the collected warnings
+        std::vector<std::string> warnings;
+    };
+
+    /// @brief a vehicle on a pedestrian lane with the values needed for computing its obstacle
+    struct VehicleObstacle {
+        const MSVehicle* veh;
+        /// @brief the longitudinal extent
+        double back;
+        double front;
+        /// @brief the space along the path which the vehicle blocks in front of it
+        double clearance;
+        /// @brief the lateral extent in pedestrian coordinates
+        double yMin;
+        double yMax;
+    };
+
+    /**
+     * @struct LaneVehicles
+     * @brief The vehicles of a lane together with an index by position
+     *
+     * Allows each pedestrian to consider only the vehicles close to it while
+     *  keeping the order in which the obstacles are written.
+     */
+    struct LaneVehicles {
+        /// @brief the vehicles in the order of the lane iterator for the direction
+        std::vector<VehicleObstacle> vehicles;
+        /// @brief pairs of back position and index into vehicles, sorted by position
+        std::vector<std::pair<double, int> > byBack;
+        /// @brief the maximum distance from the back of a vehicle to the end of its clearance
+        double maxReach;
+    };
+
+    /**
+     * @struct LaneBuffers
+     * @brief The containers used while moving the pedestrians of a lane
+     *
+     * They are cleared and refilled for every lane so their memory is reused
+     *  across lanes and simulation steps. Each parallel task gets its own instance.
+     */
+    struct LaneBuffers {
+        /// @brief for each index the next index of a pedestrian which is not waiting to enter
+        std::vector<int> nextEntered;
+        /// @brief the obstacles of the current pedestrian
+        Obstacles currentObs;
+        /// @brief the obstacles found among the neighbors of the current pedestrian
+        Obstacles neighObs;
+        /// @brief whether a stripe of neighObs is already taken by an overlapping neighbor
+        std::vector<bool> haveBlocker;
+        /// @brief the vehicles of the lane
+        LaneVehicles vehicles;
+        /// @brief for each stripe the indices of the pedestrians already placed on it (for the collision check)
+        std::vector<std::vector<int> > stripeMembers;
+    };
+
+    /**
+     * @struct LaneSnapshot
+     * @brief Copies of the pedestrian states of a lane at the begin of a parallel movement phase
+     */
+    struct LaneSnapshot {
+        /// @brief the copied states
+        std::vector<PState> states;
+        /// @brief the copies sorted for forward and for backward direction (see by_xpos_sorter)
+        Pedestrians forward;
+        Pedestrians backward;
+    };
+    typedef std::map<const MSLane*, LaneSnapshot, lane_by_numid_sorter> LaneSnapshots;
+
+#ifdef HAVE_FOX
+    /**
+     * @class MoveLaneTask
+     * @brief Moves the pedestrians of a single lane (or walking area) in a worker thread
+     */
+    class MoveLaneTask : public FXWorkerThread::Task {
+    public:
+        MoveLaneTask(MSPModel_Striping* model, const MSLane* lane, Pedestrians& pedestrians, LaneUpdate& update,
+                     LaneBuffers& buffers, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) :
+            myModel(model), myLane(lane), myPedestrians(pedestrians), myUpdate(update), myBuffers(buffers),
+            myTime(currentTime), myChangedLane(changedLane), myDir(dir) {}
+        void run(FXWorkerThread* context);
+    private:
+        MSPModel_Striping* const myModel;
+        const MSLane* const myLane;
+        Pedestrians& myPedestrians;
+        LaneUpdate& myUpdate;
+        LaneBuffers& myBuffers;
+        const SUMOTime myTime;
+        std::set<MSPerson*>& myChangedLane;
+        const int myDir;
+    private:
+        /// @brief Invalidated assignment operator.
+        MoveLaneTask& operator=(const MoveLaneTask&);
+    };
+#endif
+
     class MovePedestrians : public Command {
     public:
         MovePedestrians(MSPModel_Striping* model) : myModel(model) {};
@@ -391,11 +517,25 @@ protected:
     /// @brief move all pedestrians forward and advance to the next lane if applicable
     void moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
 
+    /** @brief move all pedestrians forward using the worker threads
+     *
+     * All lanes are moved concurrently, seeing the other lanes in the state at the begin of
+     *  the call (see LaneSnapshot). Afterwards the deferred updates are applied in lane order,
+     *  so the result does not depend on the number of threads.
+     */
+    void moveInDirectionParallel(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
+
+    /// @brief move the pedestrians of a lane (or of all paths across a walking area)
+    void moveLane(const MSLane* lane, Pedestrians& pedestrians, LaneBuffers& buffers, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, LaneUpdate* update = 0);
+
     /// @brief move pedestrians forward on one lane
-    void moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
+    void moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, LaneBuffers& buffers, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, LaneUpdate* update = 0);
 
-    /// @brief handle arrivals and lane advancement
-    void arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
+    /// @brief handle arrivals and lane advancement (only detaching the arrivals when moving in parallel)
+    void arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, LaneUpdate* update = 0);
+
+    /// @brief advance the pedestrian to the next lane or let it arrive
+    void advance(PState* p, SUMOTime currentTime, std::set<MSPerson*>& changedLane);
 
     const ActiveLanes& getActiveLanes() {
         return myActiveLanes;
@@ -425,10 +565,19 @@ private:
     /// @brief return the maximum number of pedestrians walking side by side
     static int numStripes(const MSLane* lane);
 
-    static Obstacles getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes);
+    /** @brief finds the closest pedestrians behind ego which overlap it in any stripe
+     * @param[in] pedestrians The pedestrians of the lane sorted in walking direction
+     * @param[in] egoIndex The index of ego in pedestrians
+     * @param[in] stripes The number of stripes of the lane
+     * @param[in, out] buffers The buffers of the lane, uses nextEntered and fills neighObs
+     */
+    static void getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes, LaneBuffers& buffers);
+
+    /// @brief registers the pedestrian with the given list index for the stripes it occupies
+    static void addStripeMember(std::vector<std::vector<int> >& stripeMembers, const PState& p, int index);
 
     const Obstacles& getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const MSLane* lane, const MSLane* nextLane, int stripes,
-                                          int nextDir, double currentLength, int currentDir);
+                                          int nextDir, double currentLength, int currentDir, bool useSnapshots = false);
 
     static void transformToCurrentLanePositions(Obstacles& o, int currentDir, int nextDir, double currentLength, double nextLength);
 
@@ -437,6 +586,9 @@ private:
     /// @brief retrieves the pedestian vector for the given lane (may be empty)
     Pedestrians& getPedestrians(const MSLane* lane);
 
+    /// @brief retrieves the copied pedestrians of the given lane sorted for the given direction (may be empty)
+    Pedestrians& getSnapshot(const MSLane* lane, int dir);
+
     /* @brief compute stripe-offset to transform relY values from a lane with origStripes into a lane wit destStrips
      * @note this is called once for transforming nextLane peds to into the current system as obstacles and another time
      * (in reverse) to transform the pedestrian coordinates into the nextLane-coordinates when changing lanes
@@ -447,7 +599,18 @@ private:
     static bool addCrossingVehs(const MSLane* crossing, int stripes, double lateral_offset, int dir, Obstacles& crossingVehs);
 
     ///@brief retrieve vehicle obstacles on the given lane
-    static Obstacles getVehicleObstacles(const MSLane* lane, int dir, PState* ped = 0); 
+    static Obstacles getVehicleObstacles(const MSLane* lane, int dir, PState* ped = 0);
+
+    /** @brief retrieve the obstacles of the collected vehicles of a lane
+     * @param[in] lane The lane the vehicles were collected on
+     * @param[in] dir The direction the vehicles were collected for
+     * @param[in] vehicles The collected vehicles
+     * @param[in] ped The pedestrian to look for obstacles (0 means the entry point of the lane)
+     */
+    static Obstacles getVehicleObstacles(const MSLane* lane, int dir, const LaneVehicles& vehicles, PState* ped = 0);
+
+    /// @brief collects the vehicles of the given lane for computing their obstacles
+    static void collectVehicles(const MSLane* lane, int dir, LaneVehicles& into);
 private:
     /// @brief the total number of active pedestrians
     int myNumActivePedestrians;
@@ -455,6 +618,17 @@ private:
     /// @brief store of all lanes which have pedestrians on them
     ActiveLanes myActiveLanes;
 
+    /// @brief the copied pedestrian states of the lanes while moving in parallel
+    LaneSnapshots mySnapshots;
+
+    /// @brief the buffers for moving a lane, one per parallel task (the first one is used when moving sequentially)
+    std::vector<LaneBuffers> myLaneBuffers;
+
+#ifdef HAVE_FOX
+    /// @brief the threads for moving the lanes in parallel (no threads means sequential movement)
+    FXWorkerThread::Pool myThreadPool;
+#endif
+
     /// @brief store for walkinArea elements
     static WalkingAreaPaths myWalkingAreaPaths;
     static MinNextLengths myMinNextLengths;
@@ -70,12 +70,17 @@ MSActuatedTrafficLightLogic::MSActuatedTrafficLightLogic(MSTLLogicControl& tlcon
     myPassingTime = TplConvert::_2double(getParameter("passing-time", DEFAULT_PASSING_TIME).c_str()); // passing-time seems obsolete... (Leo)
     myDetectorGap = TplConvert::_2double(getParameter("detector-gap", DEFAULT_DETECTOR_GAP).c_str());
     myShowDetectors = TplConvert::_2bool(getParameter("show-detectors", "false").c_str());
+    myUseGapSensors = TplConvert::_2bool(getParameter("gap-sensors", "false").c_str());
     myFile = FileHelpers::checkForRelativity(getParameter("file", "NUL"), basePath);
     myFreq = TIME2STEPS(TplConvert::_2double(getParameter("freq", "300").c_str()));
     myVehicleTypes = getParameter("vTypes", "");
 }
 
-MSActuatedTrafficLightLogic::~MSActuatedTrafficLightLogic() { }
+MSActuatedTrafficLightLogic::~MSActuatedTrafficLightLogic() {
+    for (GapSensorMap::iterator i = myGapSensors.begin(); i != myGapSensors.end(); ++i) {
+        delete i->second;
+    }
+}
 
 void
 MSActuatedTrafficLightLogic::init(NLDetectorBuilder& nb) {
@@ -86,6 +91,9 @@ MSActuatedTrafficLightLogic::init(NLDetectorBuilder& nb) {
     LaneVectorVector::const_iterator i2;
     LaneVector::const_iterator i;
     // build the induct loops
+    // the gap sensors are not accessible as detectors, they replace the loops only on request
+    // and if the detectors are neither shown nor write output
+    const bool useGapSensors = myUseGapSensors && !MSGlobals::gUseMesoSim && !myShowDetectors && !knowsParameter("file");
     double maxDetectorGap = 0;
     for (i2 = myLanes.begin(); i2 != myLanes.end(); ++i2) {
         const LaneVector& lanes = *i2;
@@ -101,7 +109,11 @@ MSActuatedTrafficLightLogic::init(NLDetectorBuilder& nb) {
             }
             // Build the induct loop and set it into the container
             std::string id = "TLS" + myID + "_" + myProgramID + "_InductLoopOn_" + lane->getID();
-            if (myInductLoops.find(lane) == myInductLoops.end()) {
+            if (useGapSensors) {
+                if (myGapSensors.find(lane) == myGapSensors.end()) {
+                    myGapSensors[lane] = new MSGapSensor(id, lane, ilpos, myVehicleTypes);
+                }
+            } else if (myInductLoops.find(lane) == myInductLoops.end()) {
                 myInductLoops[lane] = nb.createInductLoop(id, lane, ilpos, myVehicleTypes, myShowDetectors);
                 MSNet::getInstance()->getDetectorControl().add(SUMO_TAG_INDUCTION_LOOP, myInductLoops[lane], myFile, myFreq);
             }
@@ -193,6 +205,14 @@ MSActuatedTrafficLightLogic::gapControl() {
         if (state[i] == LINKSTATE_TL_GREEN_MAJOR || state[i] == LINKSTATE_TL_GREEN_MINOR) {
             const std::vector<MSLane*>& lanes = getLanesAt(i);
             for (LaneVector::const_iterator j = lanes.begin(); j != lanes.end(); j++) {
+                GapSensorMap::const_iterator sensor = myGapSensors.find(*j);
+                if (sensor != myGapSensors.end()) {
+                    const double actualGap = sensor->second->getTimeSinceLastDetection();
+                    if (actualGap < myMaxGap) {
+                        result = MIN2(result, actualGap);
+                    }
+                    continue;
+                }
                 if (myInductLoops.find(*j) == myInductLoops.end()) {
                     continue;
                 }
@@ -37,6 +37,7 @@
 #include <microsim/traffic_lights/MSTrafficLightLogic.h>
 #include "MSSimpleTrafficLightLogic.h"
 #include <microsim/output/MSInductLoop.h>
+#include "MSGapSensor.h"
 
 
 // ===========================================================================
@@ -57,6 +58,9 @@ public:
     /// @brief Definition of a map from lanes to induct loops lying on them
     typedef std::map<MSLane*, MSDetectorFileOutput*> InductLoopMap;
 
+    /// @brief Definition of a map from lanes to gap sensors lying on them
+    typedef std::map<MSLane*, MSGapSensor*> GapSensorMap;
+
 public:
     /** @brief Constructor
      * @param[in] tlcontrol The tls control responsible for this tls
@@ -121,6 +125,9 @@ protected:
     /// A map from lanes to induct loops lying on them
     InductLoopMap myInductLoops;
 
+    /// A map from lanes to gap sensors lying on them (used instead of induct loops if requested and no detector output or visualisation is needed)
+    GapSensorMap myGapSensors;
+
     /// The maximum gap to check in seconds
     double myMaxGap;
 
@@ -133,6 +140,9 @@ protected:
     /// Whether the detectors shall be shown in the GUI
     bool myShowDetectors;
 
+    /// Whether lightweight gap sensors shall replace the induct loops (which are visible to TraCI)
+    bool myUseGapSensors;
+
     /// The output file for generated detectors
     std::string myFile;
 
@@ -0,0 +1,131 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    MSGapSensor.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// A lightweight detector reporting the time gap since the last vehicle passed
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <algorithm>
+#include <utils/common/StringTokenizer.h>
+#include <utils/vehicle/SUMOVehicle.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSVehicleType.h>
+#include <microsim/cfmodels/MSCFModel.h>
+#include "MSGapSensor.h"
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+MSGapSensor::MSGapSensor(const std::string& id, MSLane* const lane, double position, const std::string& vTypes) :
+    MSMoveReminder(id, lane),
+    myPosition(position),
+    myLastLeaveTime(SIMTIME) {
+    const std::vector<std::string> vt = StringTokenizer(vTypes).getVector();
+    myVehicleTypes.insert(vt.begin(), vt.end());
+}
+
+
+MSGapSensor::~MSGapSensor() {}
+
+
+bool
+MSGapSensor::notifyEnter(SUMOVehicle& veh, Notification reason, const MSLane* /* enteredLane */) {
+    if (!myVehicleTypes.empty() && myVehicleTypes.count(veh.getVehicleType().getID()) == 0) {
+        return false;
+    }
+    if (reason == NOTIFICATION_DEPARTED ||
+            reason == NOTIFICATION_TELEPORT ||
+            reason == NOTIFICATION_PARKING ||
+            reason == NOTIFICATION_LANE_CHANGE) {
+        if (veh.getPositionOnLane() >= myPosition && veh.getBackPositionOnLane(myLane) < myPosition) {
+            removeVehicle(&veh);
+            myVehiclesOnDet.push_back(&veh);
+        }
+    }
+    return true;
+}
+
+
+bool
+MSGapSensor::notifyMove(SUMOVehicle& veh, double oldPos, double newPos, double newSpeed) {
+    if (newPos < myPosition) {
+        // sensor not reached yet
+        return true;
+    }
+    if (oldPos < myPosition) {
+        // entered the sensor by move
+        myVehiclesOnDet.push_back(&veh);
+    }
+    const double oldBackPos = oldPos - veh.getVehicleType().getLength();
+    const double newBackPos = newPos - veh.getVehicleType().getLength();
+    if (newBackPos > myPosition) {
+        // vehicle passed the sensor (it may have changed onto this lane somewhere past the sensor)
+        removeVehicle(&veh);
+        if (oldBackPos <= myPosition) {
+            // the leave time is recorded like in MSInductLoop::leaveDetectorByMove
+            myLastLeaveTime = SIMTIME + MSCFModel::passingTime(oldBackPos, myPosition, newBackPos, veh.getPreviousSpeed(), newSpeed);
+        }
+        return false;
+    }
+    // vehicle stays on the sensor
+    return true;
+}
+
+
+bool
+MSGapSensor::notifyLeave(SUMOVehicle& veh, double /* lastPos */, Notification reason, const MSLane* /* enteredLane */) {
+    if (reason != NOTIFICATION_JUNCTION) {
+        removeVehicle(&veh);
+        return false;
+    }
+    return true;
+}
+
+
+void
+MSGapSensor::clearState() {
+    myVehiclesOnDet.clear();
+}
+
+
+double
+MSGapSensor::getTimeSinceLastDetection() const {
+    if (!myVehiclesOnDet.empty()) {
+        // sensor is occupied
+        return 0;
+    }
+    return SIMTIME - myLastLeaveTime;
+}
+
+
+void
+MSGapSensor::removeVehicle(const SUMOVehicle* veh) {
+    std::vector<const SUMOVehicle*>::iterator it = std::find(myVehiclesOnDet.begin(), myVehiclesOnDet.end(), veh);
+    if (it != myVehiclesOnDet.end()) {
+        myVehiclesOnDet.erase(it);
+    }
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,134 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    MSGapSensor.h
+/// @date    October 2026
+/// @version $Id$
+///
+// A lightweight detector reporting the time gap since the last vehicle passed
+/****************************************************************************/
+#ifndef MSGapSensor_h
+#define MSGapSensor_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <set>
+#include <string>
+#include <vector>
+#include <microsim/MSMoveReminder.h>
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class MSLane;
+class SUMOVehicle;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSGapSensor
+ * @brief A lightweight detector reporting the time gap since the last vehicle passed
+ *
+ * The sensor detects vehicles at a point like an MSInductLoop but only keeps
+ *  the vehicles currently on it and the time the last vehicle left it. It
+ *  neither collects vehicle data nor writes output and is not registered at
+ *  the detector control, so it is invisible to TraCI and the GUI. Actuated
+ *  traffic lights use it instead of induct loops if their parameter
+ *  "gap-sensors" is set since they only need the gap since the last actuation.
+ */
+class MSGapSensor : public MSMoveReminder {
+public:
+    /** @brief Constructor, adds the sensor to the lane
+     *
+     * @param[in] id Unique id
+     * @param[in] lane Lane where the sensor is placed
+     * @param[in] position Position of the sensor on the lane
+     * @param[in] vTypes The vehicle types which shall be detected (all if empty)
+     */
+    MSGapSensor(const std::string& id, MSLane* const lane, double position, const std::string& vTypes);
+
+    /// @brief Destructor
+    ~MSGapSensor();
+
+
+    /// @name Methods inherited from MSMoveReminder
+    /// @{
+
+    /** @brief Adds vehicles which are inserted onto the sensor
+     * @see MSMoveReminder::notifyEnter
+     */
+    bool notifyEnter(SUMOVehicle& veh, Notification reason, const MSLane* enteredLane = 0);
+
+    /** @brief Registers vehicles entering and leaving the sensor by move
+     * @see MSMoveReminder::notifyMove
+     */
+    bool notifyMove(SUMOVehicle& veh, double oldPos, double newPos, double newSpeed);
+
+    /** @brief Removes vehicles which left the lane other than by move
+     * @see MSMoveReminder::notifyLeave
+     */
+    bool notifyLeave(SUMOVehicle& veh, double lastPos, Notification reason, const MSLane* enteredLane = 0);
+
+    /** @brief Forgets the vehicles on the sensor
+     * @see MSMoveReminder::clearState
+     */
+    void clearState();
+    /// @}
+
+
+    /** @brief Returns the time since the last vehicle left the sensor
+     * @return The time since the last detection, 0 if the sensor is occupied
+     * @see MSInductLoop::getTimeSinceLastDetection
+     */
+    double getTimeSinceLastDetection() const;
+
+
+private:
+    /// @brief Removes the vehicle from the vehicles on the sensor
+    void removeVehicle(const SUMOVehicle* veh);
+
+private:
+    /// @brief The position on the lane
+    const double myPosition;
+
+    /// @brief The vehicle types to detect (all if empty)
+    std::set<std::string> myVehicleTypes;
+
+    /// @brief The time the last vehicle left the sensor
+    double myLastLeaveTime;
+
+    /// @brief The vehicles currently on the sensor (usually at most one)
+    std::vector<const SUMOVehicle*> myVehiclesOnDet;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    MSGapSensor(const MSGapSensor&);
+
+    /// @brief Invalidated assignment operator
+    MSGapSensor& operator=(const MSGapSensor&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -199,6 +199,13 @@ MSSimpleTrafficLightLogic::changeStepAndDuration(MSTLLogicControl& tlcontrol,
 }
 
 
+void
+MSSimpleTrafficLightLogic::loadState(MSTLLogicControl& tlcontrol, SUMOTime simStep, int step, SUMOTime lastSwitch, SUMOTime nextSwitch) {
+    MSTrafficLightLogic::loadState(tlcontrol, simStep, step, lastSwitch, nextSwitch);
+    myPhases[myStep]->myLastSwitch = lastSwitch;
+}
+
+
 void
 MSSimpleTrafficLightLogic::setPhases(const Phases& phases, int step) {
     assert(step < (int)phases.size());
@@ -191,6 +191,11 @@ public:
     /** @brief Replaces the phases and set the phase index
      */
     void setPhases(const Phases& phases, int index);
+
+    /** @brief Restores the phase and its switch times
+     * @see MSTrafficLightLogic::loadState
+     */
+    void loadState(MSTLLogicControl& tlcontrol, SUMOTime simStep, int step, SUMOTime lastSwitch, SUMOTime nextSwitch);
     /// @}
 
 
@@ -38,6 +38,7 @@
 #include <microsim/MSNet.h>
 #include <microsim/MSEdge.h>
 #include <microsim/MSGlobals.h>
+#include <utils/iodevices/OutputDevice.h>
 #include "MSTLLogicControl.h"
 #include "MSTrafficLightLogic.h"
 
@@ -265,6 +266,26 @@ MSTrafficLightLogic::getNextSwitchTime() const {
 }
 
 
+void
+MSTrafficLightLogic::saveState(OutputDevice& out) const {
+    out.openTag(SUMO_TAG_TLLOGIC);
+    out.writeAttr(SUMO_ATTR_ID, getID());
+    out.writeAttr(SUMO_ATTR_PROGRAMID, getProgramID());
+    out.writeAttr(SUMO_ATTR_INDEX, getCurrentPhaseIndex());
+    out.writeAttr(SUMO_ATTR_BEGIN, time2string(getCurrentPhaseDef().myLastSwitch));
+    out.writeAttr(SUMO_ATTR_END, time2string(getNextSwitchTime()));
+    out.closeTag();
+}
+
+
+void
+MSTrafficLightLogic::loadState(MSTLLogicControl& tlcontrol, SUMOTime simStep, int step, SUMOTime /* lastSwitch */, SUMOTime nextSwitch) {
+    if (nextSwitch >= 0) {
+        changeStepAndDuration(tlcontrol, simStep, step, nextSwitch - simStep);
+    }
+}
+
+
 SUMOTime
 MSTrafficLightLogic::getSpentDuration() const {
     const SUMOTime nextSwitch = getNextSwitchTime();
@@ -48,6 +48,7 @@ class MSNet;
 class MSLink;
 class MSTLLogicControl;
 class NLDetectorBuilder;
+class OutputDevice;
 
 
 // ===========================================================================
@@ -335,6 +336,27 @@ public:
     /// @}
 
 
+
+    /// @name State I/O
+    /// @{
+
+    /** @brief Saves the current phase and its switch times
+     * @param[in] out The device to write the state into
+     */
+    void saveState(OutputDevice& out) const;
+
+
+    /** @brief Restores the phase and its switch times
+     * @param[in] tlcontrol The responsible traffic lights control
+     * @param[in] simStep The current simulation step
+     * @param[in] step Index of the phase to use
+     * @param[in] lastSwitch The time the phase started
+     * @param[in] nextSwitch The time of the next switch
+     */
+    virtual void loadState(MSTLLogicControl& tlcontrol, SUMOTime simStep, int step, SUMOTime lastSwitch, SUMOTime nextSwitch);
+    /// @}
+
+
 protected:
     /**
      * @class SwitchCommand
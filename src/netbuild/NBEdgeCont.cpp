@@ -837,13 +837,49 @@ NBEdgeCont::appendTurnarounds(const std::set<std::string>& ids, bool noTLSContro
 
 
 void
-NBEdgeCont::computeEdgeShapes() {
+NBEdgeCont::computeEdgeShapes(const int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        std::vector<NBEdge*> edges;
+        for (EdgeCont::iterator i = myEdges.begin(); i != myEdges.end(); i++) {
+            edges.push_back((*i).second);
+        }
+        FXWorkerThread::Pool pool(numThreads);
+        std::vector<EdgeShapeTask*> tasks;
+        const int chunkSize = (int)edges.size() / (4 * numThreads) + 1;
+        for (int i = 0; i < (int)edges.size(); i += chunkSize) {
+            tasks.push_back(new EdgeShapeTask(std::vector<NBEdge*>(edges.begin() + i, edges.begin() + MIN2((int)edges.size(), i + chunkSize))));
+            pool.add(tasks.back());
+        }
+        pool.waitAll(false);
+        // write the warnings in the order of the sequential computation
+        for (EdgeShapeTask* const task : tasks) {
+            MsgHandler::flushBuffer(task->getMessages());
+            delete task;
+        }
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (EdgeCont::iterator i = myEdges.begin(); i != myEdges.end(); i++) {
         (*i).second->computeEdgeShape();
     }
 }
 
 
+#ifdef HAVE_FOX
+void
+NBEdgeCont::EdgeShapeTask::run(FXWorkerThread* /* context */) {
+    MsgHandler::setThreadBuffer(&myMessages);
+    for (NBEdge* const edge : myEdges) {
+        edge->computeEdgeShape();
+    }
+    MsgHandler::setThreadBuffer(0);
+}
+#endif
+
+
 void
 NBEdgeCont::computeLaneShapes() {
     for (EdgeCont::iterator i = myEdges.begin(); i != myEdges.end(); ++i) {
@@ -1353,21 +1389,36 @@ NBEdgeCont::remapIDs(bool numericaIDs, bool reservedIDs, const std::string& pref
 
 void
 NBEdgeCont::checkOverlap(double threshold, double zThreshold) const {
+    // index the edges by their (widened) bounding boxes
+    NamedRTree tree;
+    for (EdgeCont::const_iterator it = myEdges.begin(); it != myEdges.end(); it++) {
+        Boundary b = it->second->getGeometry().getBoxBoundary();
+        // the additional meter accounts for the float precision of the tree
+        b.grow(it->second->getTotalWidth() + 1.);
+        const float min[2] = {static_cast<float>(b.xmin()), static_cast<float>(b.ymin())};
+        const float max[2] = {static_cast<float>(b.xmax()), static_cast<float>(b.ymax())};
+        tree.Insert(min, max, it->second);
+    }
     for (EdgeCont::const_iterator it = myEdges.begin(); it != myEdges.end(); it++) {
         const NBEdge* e1 = it->second;
         Boundary b1 = e1->getGeometry().getBoxBoundary();
         b1.grow(e1->getTotalWidth());
-        PositionVector outline1 = e1->getCCWBoundaryLine(*e1->getFromNode());
-        outline1.append(e1->getCCWBoundaryLine(*e1->getToNode()));
-        // check is symmetric. only check once per pair
-        for (EdgeCont::const_iterator it2 = it; it2 != myEdges.end(); it2++) {
-            const NBEdge* e2 = it2->second;
-            if (e1 == e2) {
-                continue;
-            }
+        std::set<std::string> candidates;
+        Named::StoringVisitor visitor(candidates);
+        const float min[2] = {static_cast<float>(b1.xmin()), static_cast<float>(b1.ymin())};
+        const float max[2] = {static_cast<float>(b1.xmax()), static_cast<float>(b1.ymax())};
+        tree.Search(min, max, visitor);
+        PositionVector outline1;
+        // check is symmetric. only check once per pair (the candidates are sorted by id like myEdges)
+        for (std::set<std::string>::const_iterator it2 = candidates.upper_bound(it->first); it2 != candidates.end(); it2++) {
+            const NBEdge* e2 = myEdges.find(*it2)->second;
             Boundary b2 = e2->getGeometry().getBoxBoundary();
             b2.grow(e2->getTotalWidth());
             if (b1.overlapsWith(b2)) {
+                if (outline1.size() == 0) {
+                    outline1 = e1->getCCWBoundaryLine(*e1->getFromNode());
+                    outline1.append(e1->getCCWBoundaryLine(*e1->getToNode()));
+                }
                 PositionVector outline2 = e2->getCCWBoundaryLine(*e2->getFromNode());
                 outline2.append(e2->getCCWBoundaryLine(*e2->getToNode()));
                 const double overlap = outline1.getOverlapWith(outline2, zThreshold);
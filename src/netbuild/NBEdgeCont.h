@@ -37,9 +37,14 @@
 #include "NBCont.h"
 #include <utils/common/SUMOVehicleClass.h>
 #include <utils/common/UtilExceptions.h>
+#include <utils/common/MsgHandler.h>
 #include <utils/geom/PositionVector.h>
 #include <utils/common/NamedRTree.h>
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
 
 // ===========================================================================
 // class declarations
@@ -433,11 +438,12 @@ public:
      *
      * Calls "NBEdge::computeEdgeShape" for all edges within the container.
      *
+     * @param[in] numThreads The number of threads to use (the edges are independent)
      * @todo Recheck whether a visitor-pattern should be used herefor
      * @todo Recheck usage
      * @see NBEdge::computeEdgeShape
      */
-    void computeEdgeShapes();
+    void computeEdgeShapes(const int numThreads = 0);
 
 
     /** @brief Computes the shapes of all lanes of all edges stored in the container
@@ -590,6 +596,28 @@ private:
     /// @brief compute the form factor for a loop of edges
     static double formFactor(const EdgeVector& loopEdges);
 
+#ifdef HAVE_FOX
+    /**
+     * @class EdgeShapeTask
+     * @brief Computes the shapes of a set of edges in a worker thread
+     */
+    class EdgeShapeTask : public FXWorkerThread::Task {
+    public:
+        EdgeShapeTask(const std::vector<NBEdge*>& edges) : myEdges(edges) {}
+        void run(FXWorkerThread* context);
+        /// @brief the messages of the computation (written after all tasks finished)
+        MsgHandler::MessageBuffer& getMessages() {
+            return myMessages;
+        }
+    private:
+        const std::vector<NBEdge*> myEdges;
+        MsgHandler::MessageBuffer myMessages;
+    private:
+        /// @brief Invalidated assignment operator.
+        EdgeShapeTask& operator=(const EdgeShapeTask&);
+    };
+#endif
+
 private:
     /// @brief The network builder; used to obtain type information
     NBTypeCont& myTypeCont;
@@ -233,6 +233,10 @@ NBFrame::fillOptions(bool forNetgen) {
     oc.addDescription("check-lane-foes.all", "Processing",
                       "Allow driving onto a multi-lane road if there are foes on other lanes (everywhere)");
 
+    oc.doRegister("processing-threads", new Option_Integer(0));
+    oc.addDescription("processing-threads", "Processing",
+                      "The number of threads for computing junction shapes, edge shapes and junction logics");
+
     oc.doRegister("sidewalks.guess", new Option_Bool(false));
     oc.addDescription("sidewalks.guess", "Processing",
                       "Guess pedestrian sidewalks based on edge speed");
@@ -509,6 +513,12 @@ NBFrame::checkOptions() {
         // make sure the option is set so heuristics cannot ignore it
         oc.set("no-internal-links", "false");
     }
+#ifndef HAVE_FOX
+    if (oc.getInt("processing-threads") > 0) {
+        WRITE_ERROR("Parallel processing is only possible when compiled with Fox.");
+        ok = false;
+    }
+#endif
     return ok;
 }
 
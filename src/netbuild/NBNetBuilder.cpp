@@ -48,6 +48,7 @@
 #include <utils/common/SysUtils.h>
 #include <utils/common/ToString.h>
 #include <utils/geom/GeoConvHelper.h>
+#include <utils/iodevices/OutputDevice.h>
 #include "NBAlgorithms.h"
 #include "NBAlgorithms_Ramps.h"
 #include "NBHeightMapper.h"
@@ -59,7 +60,10 @@
 NBNetBuilder::NBNetBuilder() :
     myEdgeCont(myTypeCont),
     myHaveLoadedNetworkWithoutInternalEdges(false),
-    myNetworkHaveCrossings(false) {
+    myNetworkHaveCrossings(false),
+    myStageBegin(0),
+    myStageShowsProgress(false),
+    myProfileStage(false) {
 }
 
 
@@ -89,63 +93,53 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
 
     // MODIFYING THE SETS OF NODES AND EDGES
 
-    long before = SysUtils::getCurrentMillis();
-
-
     // Removes edges that are connecting the same node
-    PROGRESS_BEGIN_MESSAGE("Removing self-loops");
+    beginStage("Removing self-loops");
     myNodeCont.removeSelfLoops(myDistrictCont, myEdgeCont, myTLLCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     if (mayAddOrRemove && oc.exists("remove-edges.isolated") && oc.getBool("remove-edges.isolated")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Finding isolated roads");
+        beginStage("Finding isolated roads");
         myNodeCont.removeIsolatedRoads(myDistrictCont, myEdgeCont);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     if (mayAddOrRemove && oc.exists("keep-edges.components") && oc.getInt("keep-edges.components") > 0) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Finding largest components");
+        beginStage("Finding largest components");
         myNodeCont.removeComponents(myDistrictCont, myEdgeCont, oc.getInt("keep-edges.components"));
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     if (mayAddOrRemove && oc.exists("keep-edges.postload") && oc.getBool("keep-edges.postload")) {
         if (oc.isSet("keep-edges.explicit") || oc.isSet("keep-edges.input-file")) {
-            before = SysUtils::getCurrentMillis();
-            PROGRESS_BEGIN_MESSAGE("Removing unwished edges");
+            beginStage("Removing unwished edges");
             myEdgeCont.removeUnwishedEdges(myDistrictCont);
-            PROGRESS_TIME_MESSAGE(before);
+            endStage();
         }
     }
     // Processing pt stops and lines
     if (oc.exists("ptstop-output") && oc.isSet("ptstop-output")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Processing public transport stops");
+        beginStage("Processing public transport stops");
         if (!(oc.exists("ptline-output") && oc.isSet("ptline-output"))) {
             myPTStopCont.localizePTStops(myEdgeCont);
         }
         myPTStopCont.assignLanes(myEdgeCont);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     if (oc.exists("ptline-output") && oc.isSet("ptline-output")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Revising public transport stops based on pt lines");
+        beginStage("Revising public transport stops based on pt lines");
         myPTLineCont.process(myEdgeCont);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     if (oc.exists("ptline-output") && oc.isSet("ptline-output") && oc.exists("ptline-clean-up") && oc.getBool("ptline-clean-up")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Cleaning up public transport stops that are not served by any line");
+        beginStage("Cleaning up public transport stops that are not served by any line");
         myPTStopCont.postprocess(myPTLineCont.getServedPTStops());
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     if (oc.exists("ptstop-output") && oc.isSet("ptstop-output")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Align pt stop id signs with corresponding edge id signs");
+        beginStage("Align pt stop id signs with corresponding edge id signs");
         myPTStopCont.alignIdSigns();
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     if (oc.getBool("junctions.join") || (oc.exists("ramps.guess") && oc.getBool("ramps.guess"))) {
@@ -178,10 +172,9 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     }
     int numJoined = myNodeCont.joinLoadedClusters(myDistrictCont, myEdgeCont, myTLLCont);
     if (mayAddOrRemove && oc.getBool("junctions.join")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Joining junction clusters");
+        beginStage("Joining junction clusters");
         numJoined += myNodeCont.joinJunctions(oc.getFloat("junctions.join-dist"), myDistrictCont, myEdgeCont, myTLLCont, myPTStopCont);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     if (oc.getBool("junctions.join") || (oc.exists("ramps.guess") && oc.getBool("ramps.guess"))) {
         // reset geometry to avoid influencing subsequent steps (ramps.guess)
@@ -195,12 +188,11 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     if (mayAddOrRemove) {
         int no = 0;
         const bool removeGeometryNodes = oc.exists("geometry.remove") && oc.getBool("geometry.remove");
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Removing empty nodes" + std::string(removeGeometryNodes ? " and geometry nodes" : ""));
+        beginStage("Removing empty nodes" + std::string(removeGeometryNodes ? " and geometry nodes" : ""));
         // removeUnwishedNodes needs turnDirections. @todo: try to call this less often
         NBTurningDirectionsComputer::computeTurnDirections(myNodeCont, false);
         no = myNodeCont.removeUnwishedNodes(myDistrictCont, myEdgeCont, myTLLCont, myPTStopCont, myPTLineCont, myParkingCont, removeGeometryNodes);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
         WRITE_MESSAGE("   " + toString(no) + " nodes removed.");
     }
 
@@ -221,18 +213,16 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     geoConvHelper.computeFinal(lefthand); // information needed for location element fixed at this point
 
     if (oc.exists("geometry.min-dist") && !oc.isDefault("geometry.min-dist")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Reducing geometries");
+        beginStage("Reducing geometries");
         myEdgeCont.reduceGeometries(oc.getFloat("geometry.min-dist"));
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     // @note: removing geometry can create similar edges so joinSimilarEdges  must come afterwards
     // @note: likewise splitting can destroy similarities so joinSimilarEdges must come before
     if (mayAddOrRemove &&  oc.getBool("edges.join")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Joining similar edges");
+        beginStage("Joining similar edges");
         myNodeCont.joinSimilarEdges(myDistrictCont, myEdgeCont, myTLLCont);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     if (oc.getBool("opposites.guess")) {
         PROGRESS_BEGIN_MESSAGE("guessing opposite direction edges");
@@ -241,22 +231,19 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     }
     //
     if (mayAddOrRemove &&  oc.exists("geometry.split") && oc.getBool("geometry.split")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Splitting geometry edges");
+        beginStage("Splitting geometry edges");
         myEdgeCont.splitGeometry(myNodeCont);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     // turning direction
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing turning directions");
+    beginStage("Computing turning directions");
     NBTurningDirectionsComputer::computeTurnDirections(myNodeCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     // correct edge geometries to avoid overlap
     myNodeCont.avoidOverlap();
 
     // GUESS TLS POSITIONS
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Assigning nodes to traffic lights");
+    beginStage("Assigning nodes to traffic lights");
     if (oc.isSet("tls.set")) {
         std::vector<std::string> tlControlledNodes = oc.getStringVector("tls.set");
         TrafficLightType type = SUMOXMLDefinitions::TrafficLightTypes.get(oc.getString("tls.default-type"));
@@ -270,16 +257,15 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         }
     }
     myNodeCont.guessTLs(oc, myTLLCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
 
     // guess ramps (after guessing tls because ramps should not be build at traffic lights)
     if (mayAddOrRemove) {
         if ((oc.exists("ramps.guess") && oc.getBool("ramps.guess")) || (oc.exists("ramps.set") && oc.isSet("ramps.set"))) {
-            before = SysUtils::getCurrentMillis();
-            PROGRESS_BEGIN_MESSAGE("Guessing and setting on-/off-ramps");
+            beginStage("Guessing and setting on-/off-ramps");
             NBNodesEdgesSorter::sortNodesEdges(myNodeCont);
             NBRampsComputer::computeRamps(*this, oc);
-            PROGRESS_TIME_MESSAGE(before);
+            endStage();
         }
     }
     // guess sidewalks
@@ -311,25 +297,23 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
 
     // GEOMETRY COMPUTATION
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Sorting nodes' edges");
+    beginStage("Sorting nodes' edges");
     NBNodesEdgesSorter::sortNodesEdges(myNodeCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     myEdgeCont.computeLaneShapes();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing node shapes");
+    beginStage("Computing node shapes");
+    const int numThreads = oc.exists("processing-threads") ? oc.getInt("processing-threads") : 0;
     if (oc.exists("geometry.junction-mismatch-threshold")) {
-        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"));
+        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"), numThreads);
     } else {
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
     }
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing edge shapes");
-    myEdgeCont.computeEdgeShapes();
-    PROGRESS_TIME_MESSAGE(before);
+    beginStage("Computing edge shapes");
+    myEdgeCont.computeEdgeShapes(numThreads);
+    endStage();
     // resort edges based on the node and edge shapes
     NBNodesEdgesSorter::sortNodesEdges(myNodeCont, true);
     NBTurningDirectionsComputer::computeTurnDirections(myNodeCont, false);
@@ -340,21 +324,19 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         const double speedFactor = oc.getFloat("speed.factor");
         const double speedMin = oc.getFloat("speed.minimum");
         if (speedOffset != 0 || speedFactor != 1 || speedMin > 0) {
-            before = SysUtils::getCurrentMillis();
-            PROGRESS_BEGIN_MESSAGE("Applying speed modifications");
+            beginStage("Applying speed modifications");
             for (std::map<std::string, NBEdge*>::const_iterator i = myEdgeCont.begin(); i != myEdgeCont.end(); ++i) {
                 (*i).second->setSpeed(-1, MAX2((*i).second->getSpeed() * speedFactor + speedOffset, speedMin));
             }
-            PROGRESS_TIME_MESSAGE(before);
+            endStage();
         }
     }
 
     // CONNECTIONS COMPUTATION
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing node types");
+    beginStage("Computing node types");
     NBNodeTypeComputer::computeNodeTypes(myNodeCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
     myNetworkHaveCrossings = oc.getBool("walkingareas");
     if (mayAddOrRemove && oc.getBool("crossings.guess")) {
@@ -384,51 +366,44 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     }
 
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing priorities");
+    beginStage("Computing priorities");
     NBEdgePriorityComputer::computeEdgePriorities(myNodeCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing approached edges");
+    beginStage("Computing approached edges");
     myEdgeCont.computeEdge2Edges(oc.getBool("no-left-connections"));
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
     if (mayAddOrRemove && oc.getBool("roundabouts.guess")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Guessing and setting roundabouts");
+        beginStage("Guessing and setting roundabouts");
         const int numGuessed = myEdgeCont.guessRoundabouts();
         if (numGuessed > 0) {
             WRITE_MESSAGE(" Guessed " + toString(numGuessed) + " roundabout(s).");
         }
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     myEdgeCont.markRoundabouts();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing approaching lanes");
+    beginStage("Computing approaching lanes");
     myEdgeCont.computeLanes2Edges();
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Dividing of lanes on approached lanes");
+    beginStage("Dividing of lanes on approached lanes");
     myNodeCont.computeLanes2Lanes();
     myEdgeCont.sortOutgoingLanesConnections();
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Processing turnarounds");
+    beginStage("Processing turnarounds");
     if (!oc.getBool("no-turnarounds")) {
         myEdgeCont.appendTurnarounds(oc.getBool("no-turnarounds.tls"));
     } else {
         myEdgeCont.appendTurnarounds(explicitTurnarounds, oc.getBool("no-turnarounds.tls"));
     }
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Rechecking of lane endings");
+    beginStage("Rechecking of lane endings");
     myEdgeCont.recheckLanes();
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
 
     if (myNetworkHaveCrossings && !oc.getBool("no-internal-links")) {
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
@@ -441,28 +416,24 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     }
     // join traffic lights (after building connections)
     if (oc.getBool("tls.join")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Joining traffic light nodes");
+        beginStage("Joining traffic light nodes");
         myNodeCont.joinTLS(myTLLCont, oc.getFloat("tls.join-dist"));
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     // COMPUTING RIGHT-OF-WAY AND TRAFFIC LIGHT PROGRAMS
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing traffic light control information");
+    beginStage("Computing traffic light control information");
     myTLLCont.setTLControllingInformation(myEdgeCont, myNodeCont);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing node logics");
-    myNodeCont.computeLogics(myEdgeCont, oc);
-    PROGRESS_TIME_MESSAGE(before);
+    beginStage("Computing node logics");
+    myNodeCont.computeLogics(myEdgeCont, oc, numThreads);
+    endStage();
     //
-    before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Computing traffic light logics");
+    beginStage("Computing traffic light logics");
     std::pair<int, int> numbers = myTLLCont.computeLogics(oc);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
     std::string progCount = "";
     if (numbers.first != numbers.second) {
         progCount = "(" + toString(numbers.second) + " programs) ";
@@ -470,10 +441,9 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     WRITE_MESSAGE(" " + toString(numbers.first) + " traffic light(s) " + progCount + "computed.");
     //
     if (oc.isSet("street-sign-output")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Generating street signs");
+        beginStage("Generating street signs");
         myEdgeCont.generateStreetSigns();
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     for (std::map<std::string, NBEdge*>::const_iterator i = myEdgeCont.begin(); i != myEdgeCont.end(); ++i) {
@@ -481,53 +451,48 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     }
     // FINISHING INNER EDGES
     if (!oc.getBool("no-internal-links")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Building inner edges");
+        beginStage("Building inner edges");
         // walking areas shall only be built if crossings are wished as well
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
             (*i).second->buildInnerEdges();
         }
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     // PATCH NODE SHAPES
     if (oc.getFloat("junctions.scurve-stretch") > 0) {
         // @note: nodes have collected correction hints in buildInnerEdges()
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("stretching junctions to smooth geometries");
+        beginStage("stretching junctions to smooth geometries");
         myEdgeCont.computeLaneShapes();
         myNodeCont.computeNodeShapes();
         myEdgeCont.computeEdgeShapes();
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
             (*i).second->buildInnerEdges();
         }
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     if (lefthand) {
         mirrorX();
     };
 
     if (oc.exists("geometry.check-overlap")  && oc.getFloat("geometry.check-overlap") > 0) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Checking overlapping edges");
+        beginStage("Checking overlapping edges");
         myEdgeCont.checkOverlap(oc.getFloat("geometry.check-overlap"), oc.getFloat("geometry.check-overlap.vertical-threshold"));
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
     if (oc.exists("geometry.max-grade") && oc.getFloat("geometry.max-grade") > 0 && geoConvHelper.getConvBoundary().getZRange() > 0) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Checking edge grade");
+        beginStage("Checking edge grade");
         // user input is in %
         myEdgeCont.checkGrade(oc.getFloat("geometry.max-grade") / 100);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     //find accesses for pt rail stops
     if (oc.exists("ptstop-output") && oc.isSet("ptstop-output")) {
-        before = SysUtils::getCurrentMillis();
-        PROGRESS_BEGIN_MESSAGE("Find accesses for pt rail stops");
+        beginStage("Find accesses for pt rail stops");
         double maxRadius = oc.getFloat("osm.stop-output.footway-access-distance");
         int maxCount = oc.getInt("osm.stop-output.footway-max-accesses");
         myPTStopCont.findAccessEdgesForRailStops(myEdgeCont, maxRadius, maxCount);
-        PROGRESS_TIME_MESSAGE(before);
+        endStage();
     }
 
     // report
@@ -560,10 +525,70 @@ NBNetBuilder::computeSingleNode(NBNode* node, OptionsCont& oc, const std::set<st
 */
 
 
+void
+NBNetBuilder::beginStage(const std::string& name, const bool showProgress) {
+    myStageBegin = SysUtils::getCurrentMillis();
+    myStageShowsProgress = showProgress;
+    if (showProgress) {
+        PROGRESS_BEGIN_MESSAGE(name);
+    }
+    const OptionsCont& oc = OptionsCont::getOptions();
+    myProfileStage = oc.exists("profiling-output") && oc.isSet("profiling-output");
+    if (myProfileStage) {
+        myCurrentStage.name = name;
+        myCurrentStage.memoryBegin = SysUtils::getPeakMemoryUsage();
+        myCurrentStage.cpuBegin = SysUtils::getCurrentCPUMicros();
+        myCurrentStage.wallBegin = SysUtils::getCurrentMicros();
+    }
+}
+
+
+void
+NBNetBuilder::endStage() {
+    if (myProfileStage) {
+        myCurrentStage.wall = SysUtils::getCurrentMicros() - myCurrentStage.wallBegin;
+        myCurrentStage.cpu = SysUtils::getCurrentCPUMicros() - myCurrentStage.cpuBegin;
+        myCurrentStage.memoryDelta = SysUtils::getPeakMemoryUsage() - myCurrentStage.memoryBegin;
+        myCurrentStage.nodes = (int)myNodeCont.size();
+        myCurrentStage.edges = (int)myEdgeCont.size();
+        myCurrentStage.connections = 0;
+        for (std::map<std::string, NBEdge*>::const_iterator i = myEdgeCont.begin(); i != myEdgeCont.end(); ++i) {
+            myCurrentStage.connections += (int)i->second->getConnections().size();
+        }
+        myStageProfiles.push_back(myCurrentStage);
+        myProfileStage = false;
+    }
+    if (myStageShowsProgress) {
+        PROGRESS_TIME_MESSAGE(myStageBegin);
+    }
+}
+
+
+void
+NBNetBuilder::writeProfilingOutput(const OptionsCont& oc) {
+    if (!oc.exists("profiling-output") || !oc.isSet("profiling-output")) {
+        return;
+    }
+    OutputDevice& od = OutputDevice::getDevice(oc.getString("profiling-output"));
+    od.writeXMLHeader("profiling", "");
+    for (std::vector<StageProfile>::const_iterator i = myStageProfiles.begin(); i != myStageProfiles.end(); ++i) {
+        od.openTag("stage");
+        od.writeAttr("name", i->name);
+        od.writeAttr("duration", (double)i->wall / 1000.);
+        od.writeAttr("cpu", (double)i->cpu / 1000.);
+        od.writeAttr("peakMemoryDelta", i->memoryDelta);
+        od.writeAttr("nodes", i->nodes);
+        od.writeAttr("edges", i->edges);
+        od.writeAttr("connections", i->connections);
+        od.closeTag();
+    }
+    myStageProfiles.clear();
+}
+
+
 void
 NBNetBuilder::moveToOrigin(GeoConvHelper& geoConvHelper, bool lefthand) {
-    long before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Moving network to origin");
+    beginStage("Moving network to origin");
     Boundary boundary = geoConvHelper.getConvBoundary();
     const double x = -boundary.xmin();
     const double y = -(lefthand ? boundary.ymax() : boundary.ymin());
@@ -583,7 +608,7 @@ NBNetBuilder::moveToOrigin(GeoConvHelper& geoConvHelper, bool lefthand) {
         (*i).second->reshiftPosition(x, y);
     }
     geoConvHelper.moveConvertedBy(x, y);
-    PROGRESS_TIME_MESSAGE(before);
+    endStage();
 }
 
 
@@ -139,6 +139,27 @@ public:
      */
     void compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds = std::set<std::string>(), bool mayAddOrRemove = true);
 
+    /** @brief Starts a processing stage
+     *
+     * Reports the progress and, if profiling-output is set, records the
+     *  times and the memory usage at the begin of the stage.
+     *
+     * @param[in] name The name of the stage
+     * @param[in] showProgress Whether the begin and the end of the stage shall be reported
+     */
+    void beginStage(const std::string& name, const bool showProgress = true);
+
+    /// @brief Ends the current processing stage, recording its measurements if profiling
+    void endStage();
+
+    /** @brief Writes the measurements of the processing stages ended so far
+     *
+     * Does nothing if profiling-output is not set. The written stages are discarded.
+     *
+     * @param[in] oc The options to read the output file from
+     */
+    void writeProfilingOutput(const OptionsCont& oc);
+
     /** @brief Updates the shape for a single Node
      *
      * @param[in] oc Container that contains options for building
@@ -267,6 +288,35 @@ protected:
     /// @brief flag to indicate that network has crossings
     bool myNetworkHaveCrossings;
 
+    /// @brief The measurements of a processing stage
+    struct StageProfile {
+        /// @brief the name of the stage
+        std::string name;
+        /// @brief the wall clock time, the cpu time (both in microseconds) and the peak memory at the begin
+        long long int wallBegin, cpuBegin, memoryBegin;
+        /// @brief the wall clock time and the cpu time spent (both in microseconds)
+        long long int wall, cpu;
+        /// @brief the increase of the peak memory in bytes
+        long long int memoryDelta;
+        /// @brief the numbers of nodes, edges and connections at the end of the stage
+        int nodes, edges, connections;
+    };
+
+    /// @brief the time the current stage began (for the progress message)
+    long myStageBegin;
+
+    /// @brief whether the current stage reports its progress
+    bool myStageShowsProgress;
+
+    /// @brief whether the current stage is profiled
+    bool myProfileStage;
+
+    /// @brief the current stage
+    StageProfile myCurrentStage;
+
+    /// @brief the ended stages which were not written yet
+    std::vector<StageProfile> myStageProfiles;
+
 private:
     /// @brief shift network so its lower left corner is at 0,0
     void moveToOrigin(GeoConvHelper& geoConvHelper, bool lefthand);
@@ -766,7 +766,7 @@ NBNode::removeJoinedTrafficLights() {
 }
 
 void
-NBNode::computeLogic(const NBEdgeCont& ec, OptionsCont& oc) {
+NBNode::computeLogic(const NBEdgeCont& ec, OptionsCont& oc, const bool buildBitfield) {
     delete myRequest; // possibly recomputation step
     myRequest = 0;
     if (myIncomingEdges.size() == 0 || myOutgoingEdges.size() == 0) {
@@ -803,13 +803,21 @@ NBNode::computeLogic(const NBEdgeCont& ec, OptionsCont& oc) {
             myRequest = 0;
             myType = NODETYPE_DEAD_END;
             removeJoinedTrafficLights();
-        } else {
+        } else if (buildBitfield) {
             myRequest->buildBitfieldLogic();
         }
     }
 }
 
 
+void
+NBNode::buildBitfieldLogic() {
+    if (myRequest != 0) {
+        myRequest->buildBitfieldLogic();
+    }
+}
+
+
 bool
 NBNode::writeLogic(OutputDevice& into, const bool checkLaneFoes) const {
     if (myRequest) {
@@ -348,8 +348,17 @@ public:
     /// @brief computes the connections of lanes to edges
     void computeLanes2Lanes();
 
-    /// @brief computes the node's type, logic and traffic light
-    void computeLogic(const NBEdgeCont& ec, OptionsCont& oc);
+    /** @brief computes the node's type, logic and traffic light
+     * @param[in] buildBitfield Whether the foes and responses shall be computed as well (see buildBitfieldLogic)
+     */
+    void computeLogic(const NBEdgeCont& ec, OptionsCont& oc, const bool buildBitfield = true);
+
+    /** @brief computes the foes and responses of the node's request
+     *
+     * Only needed if computeLogic was called without building the bitfield.
+     *  Does not modify anything but the request, so it may run in parallel for different nodes.
+     */
+    void buildBitfieldLogic();
 
     /// @brief writes the XML-representation of the logic as a bitset-logic XML representation
     bool writeLogic(OutputDevice& into, const bool checkLaneFoes) const;
@@ -1369,7 +1369,47 @@ NBNodeCont::computeLanes2Lanes() {
 
 // computes the "wheel" of incoming and outgoing edges for every node
 void
-NBNodeCont::computeLogics(const NBEdgeCont& ec, OptionsCont& oc) {
+NBNodeCont::computeLogics(const NBEdgeCont& ec, OptionsCont& oc, const int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        // the warnings are recorded per node and written in id order as in the sequential computation
+        std::vector<MsgHandler::MessageBuffer> messages(myNodes.size());
+        // the decisions affect traffic lights and counters shared by the nodes and are made sequentially
+        std::vector<NBNode*> nodes;
+        try {
+            for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
+                MsgHandler::setThreadBuffer(&messages[nodes.size()]);
+                (*i).second->computeLogic(ec, oc, false);
+                nodes.push_back((*i).second);
+            }
+        } catch (ProcessError&) {
+            MsgHandler::setThreadBuffer(0);
+            for (MsgHandler::MessageBuffer& buffer : messages) {
+                MsgHandler::flushBuffer(buffer);
+            }
+            throw;
+        }
+        MsgHandler::setThreadBuffer(0);
+        // the expensive foe computation only touches the node's request
+        FXWorkerThread::Pool pool(numThreads);
+        const int chunkSize = (int)nodes.size() / (4 * numThreads) + 1;
+        for (int i = 0; i < (int)nodes.size(); i += chunkSize) {
+            const int end = MIN2((int)nodes.size(), i + chunkSize);
+            std::vector<MsgHandler::MessageBuffer*> buffers;
+            for (int j = i; j < end; j++) {
+                buffers.push_back(&messages[j]);
+            }
+            pool.add(new NodeLogicTask(std::vector<NBNode*>(nodes.begin() + i, nodes.begin() + end), buffers));
+        }
+        pool.waitAll();
+        for (MsgHandler::MessageBuffer& buffer : messages) {
+            MsgHandler::flushBuffer(buffer);
+        }
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
         (*i).second->computeLogic(ec, oc);
     }
@@ -1404,13 +1444,81 @@ NBNodeCont::getFreeID() {
 
 
 void
-NBNodeCont::computeNodeShapes(double mismatchThreshold) {
+NBNodeCont::computeNodeShapes(double mismatchThreshold, const int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        // color the nodes (in id order) such that each node comes after its neighbors with smaller ids,
+        // the shared edges are then modified in the same node order as in the sequential computation
+        std::map<const NBNode*, int> colors;
+        std::vector<std::vector<NBNode*> > rounds;
+        for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
+            NBNode* const node = (*i).second;
+            int color = 0;
+            for (const NBEdge* const e : node->getEdges()) {
+                const NBNode* const other = e->getFromNode() == node ? e->getToNode() : e->getFromNode();
+                std::map<const NBNode*, int>::const_iterator c = colors.find(other);
+                if (c != colors.end()) {
+                    color = MAX2(color, c->second + 1);
+                }
+            }
+            colors[node] = color;
+            if (color >= (int)rounds.size()) {
+                rounds.resize(color + 1);
+            }
+            rounds[color].push_back(node);
+        }
+        // nodes of the same color do not share edges and are processed in parallel
+        // the warnings are recorded per node and written in id order as in the sequential computation
+        std::map<const NBNode*, MsgHandler::MessageBuffer> messages;
+        FXWorkerThread::Pool pool(numThreads);
+        for (const std::vector<NBNode*>& nodes : rounds) {
+            const int chunkSize = (int)nodes.size() / (4 * numThreads) + 1;
+            for (int i = 0; i < (int)nodes.size(); i += chunkSize) {
+                std::vector<NBNode*> chunk(nodes.begin() + i, nodes.begin() + MIN2((int)nodes.size(), i + chunkSize));
+                std::vector<MsgHandler::MessageBuffer*> buffers;
+                for (const NBNode* const node : chunk) {
+                    buffers.push_back(&messages[node]);
+                }
+                pool.add(new NodeShapeTask(chunk, buffers, mismatchThreshold));
+            }
+            pool.waitAll();
+        }
+        for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
+            MsgHandler::flushBuffer(messages[(*i).second]);
+        }
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
         (*i).second->computeNodeShape(mismatchThreshold);
     }
 }
 
 
+#ifdef HAVE_FOX
+void
+NBNodeCont::NodeShapeTask::run(FXWorkerThread* /* context */) {
+    for (int i = 0; i < (int)myNodes.size(); i++) {
+        MsgHandler::setThreadBuffer(myMessages[i]);
+        myNodes[i]->computeNodeShape(myMismatchThreshold);
+    }
+    MsgHandler::setThreadBuffer(0);
+}
+
+
+void
+NBNodeCont::NodeLogicTask::run(FXWorkerThread* /* context */) {
+    for (int i = 0; i < (int)myNodes.size(); i++) {
+        MsgHandler::setThreadBuffer(myMessages[i]);
+        myNodes[i]->buildBitfieldLogic();
+    }
+    MsgHandler::setThreadBuffer(0);
+}
+#endif
+
+
 void
 NBNodeCont::printBuiltNodesStatistics() const {
     int numUnregulatedJunctions = 0;
@@ -40,6 +40,11 @@
 #include "NBEdgeCont.h"
 #include "NBNode.h"
 #include <utils/common/UtilExceptions.h>
+#include <utils/common/MsgHandler.h>
+
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -246,8 +251,10 @@ public:
     /// divides the incoming lanes on outgoing lanes
     void computeLanes2Lanes();
 
-    /// build the list of outgoing edges and lanes
-    void computeLogics(const NBEdgeCont& ec, OptionsCont& oc);
+    /** @brief build the list of outgoing edges and lanes
+     * @param[in] numThreads The number of threads for computing the foes and responses
+     */
+    void computeLogics(const NBEdgeCont& ec, OptionsCont& oc, const int numThreads = 0);
 
     /// @brief Returns the number of nodes stored in this container
     int size() const {
@@ -261,9 +268,15 @@ public:
     std::string getFreeID();
 
     /** @brief Compute the junction shape for this node
+     *
+     * When using multiple threads, adjacent nodes are never processed at the same time
+     *  since the shape computation may extend the geometry of their common edges.
+     *  The result does not depend on the number of threads.
+     *
      * @param[in] mismatchThreshold The threshold for warning about shapes which are away from myPosition
+     * @param[in] numThreads The number of threads to use
      */
-    void computeNodeShapes(double mismatchThreshold = -1);
+    void computeNodeShapes(double mismatchThreshold = -1, const int numThreads = 0);
 
     /** @brief Prints statistics about built nodes
      *
@@ -336,6 +349,46 @@ private:
     /// @}
 
 
+#ifdef HAVE_FOX
+    /**
+     * @class NodeShapeTask
+     * @brief Computes the shapes of a set of nodes in a worker thread
+     */
+    class NodeShapeTask : public FXWorkerThread::Task {
+    public:
+        NodeShapeTask(const std::vector<NBNode*>& nodes, const std::vector<MsgHandler::MessageBuffer*>& messages, const double mismatchThreshold)
+            : myNodes(nodes), myMessages(messages), myMismatchThreshold(mismatchThreshold) {}
+        void run(FXWorkerThread* context);
+    private:
+        const std::vector<NBNode*> myNodes;
+        /// @brief the buffers for the messages of each node (written after all rounds finished)
+        const std::vector<MsgHandler::MessageBuffer*> myMessages;
+        const double myMismatchThreshold;
+    private:
+        /// @brief Invalidated assignment operator.
+        NodeShapeTask& operator=(const NodeShapeTask&);
+    };
+
+    /**
+     * @class NodeLogicTask
+     * @brief Computes the foes and responses of a set of nodes in a worker thread
+     */
+    class NodeLogicTask : public FXWorkerThread::Task {
+    public:
+        NodeLogicTask(const std::vector<NBNode*>& nodes, const std::vector<MsgHandler::MessageBuffer*>& messages)
+            : myNodes(nodes), myMessages(messages) {}
+        void run(FXWorkerThread* context);
+    private:
+        const std::vector<NBNode*> myNodes;
+        /// @brief the buffers for the messages of each node (written after all tasks finished)
+        const std::vector<MsgHandler::MessageBuffer*> myMessages;
+    private:
+        /// @brief Invalidated assignment operator.
+        NodeLogicTask& operator=(const NodeLogicTask&);
+    };
+#endif
+
+
 private:
     /// @brief The running internal id
     int myInternalID;
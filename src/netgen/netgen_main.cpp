@@ -225,12 +225,14 @@ main(int argc, char** argv) {
         NBNetBuilder nb;
         nb.applyOptions(oc);
         // build the netgen-network description
+        nb.beginStage("Generating network", false);
         NGNet* net = buildNetwork(nb);
         // ... and we have to do this...
         oc.resetWritable();
         // transfer to the netbuilding structures
         net->toNB();
         delete net;
+        nb.endStage();
         // report generated structures
         WRITE_MESSAGE(" Generation done;");
         WRITE_MESSAGE("   " + toString<int>(nb.getNodeCont().size()) + " nodes generated.");
@@ -263,6 +263,9 @@ NIFrame::fillOptions() {
     oc.doRegister("osm.skip-duplicates-check", new Option_Bool(false));
     oc.addDescription("osm.skip-duplicates-check", "Processing", "Skips the check for duplicate nodes and edges");
 
+    oc.doRegister("osm.lean-import", new Option_Bool(false));
+    oc.addDescription("osm.lean-import", "Processing", "Only loads the nodes which are referenced by traffic related ways or by relations (the loaded nodes are still stored as individual objects)");
+
     oc.doRegister("osm.elevation", new Option_Bool(false));
     oc.addDescription("osm.elevation", "Processing", "Imports elevation data");
 
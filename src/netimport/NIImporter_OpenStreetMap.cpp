@@ -135,14 +135,31 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
     /* Parse file(s)
      * Each file is parsed twice: first for nodes, second for edges. */
     std::vector<std::string> files = oc.getStringVector("osm-files");
-    // load nodes, first
-    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc);
     for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
-        // nodes
         if (!FileHelpers::isReadable(*file)) {
             WRITE_ERROR("Could not open osm-file '" + *file + "'.");
             return;
         }
+    }
+    // collect the nodes which may be needed, optionally
+    std::vector<long long int> referencedNodes;
+    const bool lean = oc.getBool("osm.lean-import");
+    if (lean) {
+        ReferencesHandler referencesHandler(referencedNodes);
+        for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+            referencesHandler.setFileName(*file);
+            PROGRESS_BEGIN_MESSAGE("Parsing node references from osm-file '" + *file + "'");
+            if (!XMLSubSys::runParser(referencesHandler, *file)) {
+                return;
+            }
+            PROGRESS_DONE_MESSAGE();
+        }
+        referencesHandler.finish();
+    }
+    // load nodes, first
+    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc, lean ? &referencedNodes : nullptr);
+    for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+        // nodes
         nodesHandler.setFileName(*file);
         PROGRESS_BEGIN_MESSAGE("Parsing nodes from osm-file '" + *file + "'");
         if (!XMLSubSys::runParser(nodesHandler, *file)) {
@@ -151,7 +168,7 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         PROGRESS_DONE_MESSAGE();
     }
     // load edges, then
-    EdgesHandler edgesHandler(myOSMNodes, myEdges, myPlatformShapes);
+    EdgesHandler edgesHandler(myOSMNodes, myEdges, myPlatformShapes, lean ? &referencedNodes : nullptr);
     for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
         // edges
         edgesHandler.setFileName(*file);
@@ -660,12 +677,85 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
     return newIndex;
 }
 
+// ---------------------------------------------------------------------------
+// definitions of NIImporter_OpenStreetMap::ReferencesHandler-methods
+// ---------------------------------------------------------------------------
+NIImporter_OpenStreetMap::ReferencesHandler::ReferencesHandler(std::vector<long long int>& toFill) :
+    SUMOSAXHandler("osm - file"),
+    myToFill(toFill),
+    myInWay(false),
+    myCurrentIsRelevant(false) {
+}
+
+
+NIImporter_OpenStreetMap::ReferencesHandler::~ReferencesHandler() = default;
+
+
+void
+NIImporter_OpenStreetMap::ReferencesHandler::finish() {
+    std::sort(myToFill.begin(), myToFill.end());
+    myToFill.erase(std::unique(myToFill.begin(), myToFill.end()), myToFill.end());
+    // release the memory of the duplicates
+    std::vector<long long int>(myToFill).swap(myToFill);
+}
+
+
+bool
+NIImporter_OpenStreetMap::ReferencesHandler::isRelevantWayKey(const std::string& key) {
+    return (key == "highway" || key == "railway" || key == "waterway" || key == "route" || key == "public_transport"
+            || StringUtils::startsWith(key, "cycleway") || StringUtils::startsWith(key, "busway")
+            || StringUtils::startsWith(key, "sidewalk"));
+}
+
+
+void
+NIImporter_OpenStreetMap::ReferencesHandler::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    if (element == SUMO_TAG_WAY) {
+        myInWay = true;
+        myCurrentIsRelevant = false;
+        myCurrentRefs.clear();
+    } else if (element == SUMO_TAG_ND && myInWay) {
+        bool ok = true;
+        const long long int ref = attrs.get<long long int>(SUMO_ATTR_REF, nullptr, ok);
+        if (ok) {
+            myCurrentRefs.push_back(ref);
+        }
+    } else if (element == SUMO_TAG_TAG && myInWay && !myCurrentIsRelevant) {
+        bool ok = true;
+        const std::string key = attrs.get<std::string>(SUMO_ATTR_K, nullptr, ok, false);
+        myCurrentIsRelevant = ok && isRelevantWayKey(key);
+    } else if (element == SUMO_TAG_MEMBER) {
+        // via nodes of restrictions and stops of public transport routes
+        bool ok = true;
+        const std::string memberType = attrs.get<std::string>(SUMO_ATTR_TYPE, nullptr, ok, false);
+        if (ok && memberType == "node") {
+            const long long int ref = attrs.get<long long int>(SUMO_ATTR_REF, nullptr, ok);
+            if (ok) {
+                myToFill.push_back(ref);
+            }
+        }
+    }
+}
+
+
+void
+NIImporter_OpenStreetMap::ReferencesHandler::myEndElement(int element) {
+    if (element == SUMO_TAG_WAY) {
+        if (myCurrentIsRelevant) {
+            myToFill.insert(myToFill.end(), myCurrentRefs.begin(), myCurrentRefs.end());
+        }
+        myInWay = false;
+    }
+}
+
+
 // ---------------------------------------------------------------------------
 // definitions of NIImporter_OpenStreetMap::NodesHandler-methods
 // ---------------------------------------------------------------------------
 NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIOSMNode*>& toFill,
         std::set<NIOSMNode*, CompareNodes>& uniqueNodes,
-        const OptionsCont& oc)
+        const OptionsCont& oc,
+        const std::vector<long long int>* referenced)
 
     :
     SUMOSAXHandler("osm - file"),
@@ -675,7 +765,8 @@ NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIO
     myHierarchyLevel(0),
     myUniqueNodes(uniqueNodes),
     myImportElevation(oc.getBool("osm.elevation")),
-    myOptionsCont(oc) {
+    myOptionsCont(oc),
+    myReferencedNodes(referenced) {
 }
 
 NIImporter_OpenStreetMap::NodesHandler::~NodesHandler() = default;
@@ -699,6 +790,10 @@ NIImporter_OpenStreetMap::NodesHandler::myStartElement(int element, const SUMOSA
             return;
         }
         myLastNodeID = -1;
+        if (myReferencedNodes != nullptr && !std::binary_search(myReferencedNodes->begin(), myReferencedNodes->end(), id)) {
+            // not needed for the network
+            return;
+        }
         if (myToFill.find(id) == myToFill.end()) {
             myLastNodeID = id;
             // assume we are loading multiple files...
@@ -806,12 +901,14 @@ NIImporter_OpenStreetMap::NodesHandler::myEndElement(int element) {
 // ---------------------------------------------------------------------------
 NIImporter_OpenStreetMap::EdgesHandler::EdgesHandler(
     const std::map<long long int, NIOSMNode*>& osmNodes,
-    std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes)
+    std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes,
+    const std::vector<long long int>* referenced)
     :
     SUMOSAXHandler("osm - file"),
     myOSMNodes(osmNodes),
     myEdgeMap(toFill),
-    myPlatformShapesMap(platformShapes) {
+    myPlatformShapesMap(platformShapes),
+    myReferencedNodes(referenced) {
     mySpeedMap["signals"] = MAXSPEED_UNGIVEN;
     mySpeedMap["none"] = 300.;
     mySpeedMap["no"] = 300.;
@@ -846,7 +943,9 @@ NIImporter_OpenStreetMap::EdgesHandler::myStartElement(int element,
         if (ok) {
             auto node = myOSMNodes.find(ref);
             if (node == myOSMNodes.end()) {
-                WRITE_WARNING("The referenced geometry information (ref='" + toString(ref) + "') is not known");
+                if (myReferencedNodes == nullptr || std::binary_search(myReferencedNodes->begin(), myReferencedNodes->end(), ref)) {
+                    WRITE_WARNING("The referenced geometry information (ref='" + toString(ref) + "') is not known");
+                }
                 return;
             }
 
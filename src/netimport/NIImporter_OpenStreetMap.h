@@ -287,6 +287,82 @@ protected:
     static const double MAXSPEED_UNGIVEN;
     static const long long int INVALID_ID;
 
+    /**
+     * @class ReferencesHandler
+     * @brief A class which collects the ids of the OSM-nodes which may be needed for building the network
+     *
+     * Used for a lean import of large files: only the nodes referenced by ways
+     *  with a traffic related key (see isRelevantWayKey) and the nodes being
+     *  members of relations are loaded afterwards.
+     */
+    class ReferencesHandler : public SUMOSAXHandler {
+    public:
+        /** @brief Contructor
+         * @param[in, out] toFill The container to add the ids of the referenced nodes to
+         */
+        ReferencesHandler(std::vector<long long int>& toFill);
+
+
+        /// @brief Destructor
+        ~ReferencesHandler() override;
+
+
+        /// @brief Sorts the collected ids and removes duplicates
+        void finish();
+
+
+        /// @brief Returns whether ways with the given key may contribute to the network
+        static bool isRelevantWayKey(const std::string& key);
+
+
+    protected:
+        /// @name inherited from GenericSAXHandler
+        //@{
+
+        /** @brief Called on the opening of a tag;
+         *
+         * @param[in] element ID of the currently opened element
+         * @param[in] attrs Attributes within the currently opened element
+         * @exception ProcessError If something fails
+         * @see GenericSAXHandler::myStartElement
+         */
+        void myStartElement(int element, const SUMOSAXAttributes& attrs) override;
+
+
+        /** @brief Called when a closing tag occurs
+         *
+         * @param[in] element ID of the currently opened element
+         * @exception ProcessError If something fails
+         * @see GenericSAXHandler::myEndElement
+         */
+        void myEndElement(int element) override;
+        //@}
+
+
+    private:
+        /// @brief The ids of the referenced nodes
+        std::vector<long long int>& myToFill;
+
+        /// @brief The node references of the currently parsed way
+        std::vector<long long int> myCurrentRefs;
+
+        /// @brief Whether a way is currently parsed
+        bool myInWay;
+
+        /// @brief Whether the currently parsed way has a relevant key
+        bool myCurrentIsRelevant;
+
+
+    private:
+        /** @brief invalidated copy constructor */
+        ReferencesHandler(const ReferencesHandler& s);
+
+        /** @brief invalidated assignment operator */
+        ReferencesHandler& operator=(const ReferencesHandler& s);
+
+    };
+
+
     /**
      * @class NodesHandler
      * @brief A class which extracts OSM-nodes from a parsed OSM-file
@@ -298,10 +374,12 @@ protected:
          * @param[in, out] toFill The nodes container to fill
          * @param[in, out] uniqueNodes The nodes container for ensuring uniqueness
          * @param[in] options The options to use
+         * @param[in] referenced The sorted ids of the nodes to load (nullptr loads all nodes)
          */
         NodesHandler(std::map<long long int, NIOSMNode*>& toFill, std::set<NIOSMNode*,
                      CompareNodes>& uniqueNodes,
-                     const OptionsCont& cont);
+                     const OptionsCont& cont,
+                     const std::vector<long long int>* referenced = nullptr);
 
 
         /// @brief Destructor
@@ -355,6 +433,9 @@ protected:
         /// @brief the options
         const OptionsCont& myOptionsCont;
 
+        /// @brief the sorted ids of the nodes to load (nullptr if all nodes are loaded)
+        const std::vector<long long int>* myReferencedNodes;
+
 
     private:
         /** @brief invalidated copy constructor */
@@ -376,9 +457,11 @@ protected:
          *
          * @param[in] osmNodes The previously parsed (osm-)nodes
          * @param[in, out] toFill The edges container to fill with read edges
+         * @param[in] referenced The sorted ids of the loaded nodes (nullptr if all nodes were loaded)
          */
         EdgesHandler(const std::map<long long int, NIOSMNode*>& osmNodes,
-                     std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes);
+                     std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes,
+                     const std::vector<long long int>* referenced = nullptr);
 
 
         /// @brief Destructor
@@ -428,6 +511,9 @@ protected:
         /// @brief A map of non-numeric speed descriptions to their numeric values
         std::map<std::string, double> mySpeedMap;
 
+        /// @brief the sorted ids of the loaded nodes (nullptr if all nodes were loaded)
+        const std::vector<long long int>* myReferencedNodes;
+
     private:
         /** @brief invalidated copy constructor */
         EdgesHandler(const EdgesHandler& s);
@@ -76,6 +76,7 @@ NILoader::~NILoader() {}
 void
 NILoader::load(OptionsCont& oc) {
     // load types first
+    myNetBuilder.beginStage("Loading types", false);
     NIXMLTypesHandler* handler =
         new NIXMLTypesHandler(myNetBuilder.getTypeCont());
     if (!oc.isSet("type-files")) {
@@ -92,7 +93,9 @@ NILoader::load(OptionsCont& oc) {
     }
     // try to load height data so it is ready for use by other importers
     NBHeightMapper::loadIfSet(oc);
+    myNetBuilder.endStage();
     // try to load using different methods
+    myNetBuilder.beginStage("Importing networks", false);
     NIImporter_SUMO::loadNetwork(oc, myNetBuilder);
     NIImporter_RobocupRescue::loadNetwork(oc, myNetBuilder);
     NIImporter_OpenStreetMap::loadNetwork(oc, myNetBuilder);
@@ -111,7 +114,10 @@ NILoader::load(OptionsCont& oc) {
             WRITE_MESSAGE(" Removed " + toString(removed) + " traffic lights before loading plain-XML");
         }
     }
+    myNetBuilder.endStage();
+    myNetBuilder.beginStage("Loading plain XML", false);
     loadXML(oc);
+    myNetBuilder.endStage();
     // check the loaded structures
     if (myNetBuilder.getNodeCont().size() == 0) {
         throw ProcessError("No nodes loaded.");
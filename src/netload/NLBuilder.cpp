@@ -42,10 +42,12 @@
 #include <utils/common/TplConvert.h>
 #include <utils/common/FileHelpers.h>
 #include <utils/common/SysUtils.h>
+#include <utils/common/StringUtils.h>
 #include <utils/common/ToString.h>
 #include <utils/xml/SUMORouteLoaderControl.h>
 #include <utils/xml/SUMORouteLoader.h>
 #include <utils/xml/XMLSubSys.h>
+#include <utils/xml/SUMOSAXBinaryWriter.h>
 #include <mesosim/MEVehicleControl.h>
 #include <microsim/MSVehicleControl.h>
 #include <microsim/MSVehicleTransfer.h>
@@ -327,7 +329,8 @@ NLBuilder::load(const std::string& mmlWhat, const bool isNet) {
     for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
         PROGRESS_BEGIN_MESSAGE("Loading " + mmlWhat + " from '" + *fileIt + "'");
         long before = SysUtils::getCurrentMillis();
-        if (!XMLSubSys::runParser(myXMLHandler, *fileIt, isNet)) {
+        const bool ok = isNet && myOptions.getBool("net-file.binary-cache") ? loadCached(*fileIt) : XMLSubSys::runParser(myXMLHandler, *fileIt, isNet);
+        if (!ok) {
             WRITE_MESSAGE("Loading of " + mmlWhat + " failed.");
             return false;
         }
@@ -337,6 +340,41 @@ NLBuilder::load(const std::string& mmlWhat, const bool isNet) {
 }
 
 
+bool
+NLBuilder::loadCached(const std::string& file) {
+    if (StringUtils::endsWith(file, ".sbx")) {
+        return XMLSubSys::runParser(myXMLHandler, file, true);
+    }
+    std::string cache = file;
+    if (StringUtils::endsWith(cache, ".gz")) {
+        cache = cache.substr(0, cache.length() - 3);
+    }
+    if (StringUtils::endsWith(cache, ".xml")) {
+        cache = cache.substr(0, cache.length() - 4);
+    }
+    cache += ".sbx";
+    if (SUMOSAXBinaryWriter::isUpToDate(cache, file)) {
+        return XMLSubSys::runParser(myXMLHandler, cache, true);
+    }
+    SUMOSAXBinaryWriter* writer = 0;
+    try {
+        writer = new SUMOSAXBinaryWriter(myXMLHandler, cache);
+    } catch (IOError& e) {
+        WRITE_WARNING("Could not write binary network cache '" + cache + "' (" + e.what() + ").");
+        return XMLSubSys::runParser(myXMLHandler, file, true);
+    }
+    const std::string prevFile = myXMLHandler.getFileName();
+    myXMLHandler.setFileName(file);
+    const bool ok = XMLSubSys::runParser(*writer, file, true);
+    myXMLHandler.setFileName(prevFile);
+    if (ok && !MsgHandler::getErrorInstance()->wasInformed() && !writer->finish(file)) {
+        WRITE_WARNING("Could not write binary network cache '" + cache + "'.");
+    }
+    delete writer;
+    return ok;
+}
+
+
 SUMORouteLoaderControl*
 NLBuilder::buildRouteLoaderControl(const OptionsCont& oc) {
     // build the loaders
@@ -351,7 +389,7 @@ NLBuilder::buildRouteLoaderControl(const OptionsCont& oc) {
         }
         // open files for reading
         for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
-            loaders->add(new SUMORouteLoader(new MSRouteHandler(*fileIt, false)));
+            loaders->add(new SUMORouteLoader(new MSRouteHandler(*fileIt, false), oc.getBool("route-loading.threaded")));
         }
     }
     return loaders;
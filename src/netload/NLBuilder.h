@@ -115,6 +115,15 @@ protected:
     bool load(const std::string& mmlWhat, const bool isNet = false);
 
 
+    /** @brief Loads the network from its binary copy, writing the copy if it is missing or outdated
+     *
+     * The copy is stored next to the given file with the extension ".sbx".
+     * @param[in] file The network file
+     * @return Whether loading was successfull
+     */
+    bool loadCached(const std::string& file);
+
+
     /** @brief Closes the net building process
      *
      * Builds the microsim-structures which belong to a MSNet using the factories
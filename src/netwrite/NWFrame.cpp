@@ -32,7 +32,6 @@
 #include <utils/options/OptionsCont.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/SystemFrame.h>
-#include <utils/common/SysUtils.h>
 #include <utils/iodevices/OutputDevice.h>
 #include <netbuild/NBNetBuilder.h>
 #include "NWFrame.h"
@@ -104,6 +103,9 @@ NWFrame::fillOptions(bool forNetgen) {
     oc.doRegister("street-sign-output", new Option_FileName());
     oc.addDescription("street-sign-output", "Output", "Writes street signs as POIs to FILE");
 
+    oc.doRegister("profiling-output", new Option_FileName());
+    oc.addDescription("profiling-output", "Output", "Writes the computation time, the processor time, the peak memory increase and the object counts of the processing stages to FILE");
+
     if (!forNetgen) {
         oc.doRegister("ptstop-output", new Option_FileName());
         oc.addDescription("ptstop-output", "Output", "Writes public transport stops to FILE");
@@ -179,15 +181,15 @@ NWFrame::checkOptions() {
 
 void
 NWFrame::writeNetwork(const OptionsCont& oc, NBNetBuilder& nb) {
-    long before = SysUtils::getCurrentMillis();
-    PROGRESS_BEGIN_MESSAGE("Writing network");
+    nb.beginStage("Writing network");
     NWWriter_SUMO::writeNetwork(oc, nb);
     NWWriter_Amitran::writeNetwork(oc, nb);
     NWWriter_MATSim::writeNetwork(oc, nb);
     NWWriter_OpenDrive::writeNetwork(oc, nb);
     NWWriter_DlrNavteq::writeNetwork(oc, nb);
     NWWriter_XML::writeNetwork(oc, nb);
-    PROGRESS_TIME_MESSAGE(before);
+    nb.endStage();
+    nb.writeProfilingOutput(oc);
 }
 
 
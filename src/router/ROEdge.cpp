@@ -137,6 +137,15 @@ ROEdge::addTravelTime(double value, double timeBegin, double timeEnd) {
 }
 
 
+void
+ROEdge::resetTimeLines() {
+    myTravelTimes.clear();
+    myUsingTTTimeLine = false;
+    myEfforts.clear();
+    myUsingETimeLine = false;
+}
+
+
 double
 ROEdge::getEffort(const ROVehicle* const veh, double time) const {
     double ret = 0;
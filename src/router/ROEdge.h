@@ -304,6 +304,14 @@ public:
     void addTravelTime(double value, double timeBegin, double timeEnd);
 
 
+    /** @brief Removes all loaded travel times and efforts
+     *
+     * Afterwards the edge uses its default travel time and effort until
+     *  new values are added (and "buildTimeLines" is called again).
+     */
+    void resetTimeLines();
+
+
     /** @brief Returns the number of edges this edge is connected to
      *
      * If this edge's type is set to "sink", 0 is returned, otherwise
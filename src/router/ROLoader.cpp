@@ -252,6 +252,13 @@ ROLoader::loadWeights(RONet& net, const std::string& optionName,
     if (!myOptions.isUsableFileList(optionName)) {
         return false;
     }
+    return loadWeightFiles(net, myOptions.getStringVector(optionName), measure, useLanes, boundariesOverride);
+}
+
+
+bool
+ROLoader::loadWeightFiles(RONet& net, const std::vector<std::string>& files,
+                          const std::string& measure, const bool useLanes, const bool boundariesOverride) {
     // build and prepare the weights handler
     std::vector<SAXWeightsHandler::ToRetrieveDefinition*> retrieverDefs;
     //  travel time, first (always used)
@@ -269,7 +276,6 @@ ROLoader::loadWeights(RONet& net, const std::string& optionName,
     //  set up handler
     SAXWeightsHandler handler(retrieverDefs, "");
     // go through files
-    std::vector<std::string> files = myOptions.getStringVector(optionName);
     for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
         PROGRESS_BEGIN_MESSAGE("Loading precomputed net weights from '" + *fileIt + "'");
         if (XMLSubSys::runParser(handler, *fileIt)) {
@@ -78,6 +78,10 @@ public:
     bool loadWeights(RONet& net, const std::string& optionName,
                      const std::string& measure, const bool useLanes, const bool boundariesOverride);
 
+    /// Loads the net weights from the given files
+    bool loadWeightFiles(RONet& net, const std::vector<std::string>& files,
+                         const std::string& measure, const bool useLanes, const bool boundariesOverride);
+
     /** @brief Builds and opens all route loaders */
     void openRoutes(RONet& net);
 
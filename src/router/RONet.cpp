@@ -68,6 +68,7 @@ RONet::RONet()
     : myVehicleTypes(), myDefaultVTypeMayBeDeleted(true),
       myDefaultPedTypeMayBeDeleted(true), myDefaultBikeTypeMayBeDeleted(true),
       myHaveActiveFlows(true),
+      myKeepRoutables(false),
       myRoutesOutput(0), myRouteAlternativesOutput(0), myTypesOutput(0),
       myReadRouteNo(0), myDiscardedRouteNo(0), myWrittenRouteNo(0),
       myHavePermissions(false),
@@ -118,6 +119,21 @@ RONet::~RONet() {
         delete r;
     }
     myRoutables.clear();
+    for (RoutablesMap::iterator routables = myKeptRoutables.begin(); routables != myKeptRoutables.end(); ++routables) {
+        for (RORoutable* const r : routables->second) {
+            // public transport vehicles are deleted together with myPTVehicles
+            if (!r->isPublicTransport() || r->isPartOfFlow()) {
+                const ROVehicle* const veh = dynamic_cast<const ROVehicle*>(r);
+                if (veh != 0 && veh->getRouteDefinition()->getID()[0] == '!') {
+                    if (!myRoutes.remove(veh->getRouteDefinition()->getID())) {
+                        delete veh->getRouteDefinition();
+                    }
+                }
+                delete r;
+            }
+        }
+    }
+    myKeptRoutables.clear();
 }
 
 
@@ -607,32 +623,25 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
                 }
             }
             lastTime = routableTime;
-            for (const RORoutable* const r : routables->second) {
-                // ok, check whether it has been routed
-                if (r->getRoutingSuccess()) {
-                    // write the route
-                    r->write(*myRoutesOutput, myRouteAlternativesOutput, myTypesOutput, options);
-                    myWrittenRouteNo++;
-                } else {
-                    myDiscardedRouteNo++;
-                }
-                // delete routes and the vehicle
-                if (!r->isPublicTransport() || r->isPartOfFlow()) {
-                    const ROVehicle* const veh = dynamic_cast<const ROVehicle*>(r);
-                    if (veh != 0 && veh->getRouteDefinition()->getID()[0] == '!') {
-                        if (!myRoutes.remove(veh->getRouteDefinition()->getID())) {
-                            delete veh->getRouteDefinition();
-                        }
-                    }
-                    delete r;
+            if (myKeepRoutables) {
+                // keep them for further routing iterations
+                std::vector<RORoutable*>& kept = myKeptRoutables[routableTime];
+                kept.insert(kept.end(), routables->second.begin(), routables->second.end());
+            } else {
+                for (const RORoutable* const r : routables->second) {
+                    writeAndRemove(r, *myRoutesOutput, myRouteAlternativesOutput, myTypesOutput, options);
                 }
             }
             myRoutables.erase(routables);
         }
         if (containerTime == minTime) {
-            myRoutesOutput->writePreformattedTag(container->second);
-            if (myRouteAlternativesOutput != 0) {
-                myRouteAlternativesOutput->writePreformattedTag(container->second);
+            if (myKeepRoutables) {
+                myKeptContainers.insert(*container);
+            } else {
+                myRoutesOutput->writePreformattedTag(container->second);
+                if (myRouteAlternativesOutput != 0) {
+                    myRouteAlternativesOutput->writePreformattedTag(container->second);
+                }
             }
             myContainers.erase(container);
         }
@@ -641,6 +650,116 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
 }
 
 
+void
+RONet::writeAndRemove(const RORoutable* const r, OutputDevice& os, OutputDevice* const altos,
+                      OutputDevice* const typeos, OptionsCont& options) {
+    // ok, check whether it has been routed
+    if (r->getRoutingSuccess()) {
+        // write the route
+        r->write(os, altos, typeos, options);
+        myWrittenRouteNo++;
+    } else {
+        myDiscardedRouteNo++;
+    }
+    // delete routes and the vehicle
+    if (!r->isPublicTransport() || r->isPartOfFlow()) {
+        const ROVehicle* const veh = dynamic_cast<const ROVehicle*>(r);
+        if (veh != 0 && veh->getRouteDefinition()->getID()[0] == '!') {
+            if (!myRoutes.remove(veh->getRouteDefinition()->getID())) {
+                delete veh->getRouteDefinition();
+            }
+        }
+        delete r;
+    }
+}
+
+
+void
+RONet::rerouteKept(OptionsCont& options, const RORouterProvider& provider) {
+    const bool removeLoops = options.getBool("remove-loops");
+    const bool tryRepair = options.getBool("repair");
+    // forget the routes of the last iteration before routing anything
+    // (route definitions may be shared between vehicles)
+    std::vector<ROVehicle*> vehicles;
+    for (RoutablesMap::const_iterator i = myKeptRoutables.begin(); i != myKeptRoutables.end(); ++i) {
+        for (RORoutable* const r : i->second) {
+            ROVehicle* const veh = dynamic_cast<ROVehicle*>(r);
+            // persons keep the plan computed in the first iteration
+            if (veh != 0 && veh->getRouteDefinition() != 0) {
+                veh->getRouteDefinition()->prepareRerouting(tryRepair);
+                vehicles.push_back(veh);
+            }
+        }
+    }
+#ifdef HAVE_FOX
+    const int maxNumThreads = options.getInt("routing-threads");
+    while ((int)myThreadPool.size() < maxNumThreads) {
+        new WorkerThread(myThreadPool, provider);
+    }
+#endif
+    for (ROVehicle* const veh : vehicles) {
+#ifdef HAVE_FOX
+        if (myThreadPool.size() > 0) {
+            myThreadPool.add(new RoutingTask(veh, removeLoops, myErrorHandler));
+            continue;
+        }
+#endif
+        veh->computeRoute(provider, removeLoops, myErrorHandler);
+    }
+#ifdef HAVE_FOX
+    myThreadPool.waitAll();
+#endif
+}
+
+
+void
+RONet::writeKept(OutputDevice& os, OptionsCont& options) {
+    writeKeptRoutables(os, 0, 0, options, false);
+}
+
+
+void
+RONet::saveAndRemoveKept(OptionsCont& options) {
+    writeKeptRoutables(*myRoutesOutput, myRouteAlternativesOutput, myTypesOutput, options, true);
+}
+
+
+void
+RONet::writeKeptRoutables(OutputDevice& os, OutputDevice* const altos, OutputDevice* const typeos,
+                          OptionsCont& options, const bool remove) {
+    // each iteration writes the vehicle types again
+    for (const auto& i : myVehicleTypes) {
+        i.second->saved = false;
+    }
+    RoutablesMap::iterator routables = myKeptRoutables.begin();
+    ContainerMap::iterator container = myKeptContainers.begin();
+    while (routables != myKeptRoutables.end() || container != myKeptContainers.end()) {
+        const SUMOTime routableTime = routables == myKeptRoutables.end() ? SUMOTime_MAX : routables->first;
+        const SUMOTime containerTime = container == myKeptContainers.end() ? SUMOTime_MAX : container->first;
+        if (routableTime <= containerTime) {
+            for (const RORoutable* const r : routables->second) {
+                if (remove) {
+                    writeAndRemove(r, os, altos, typeos, options);
+                } else if (r->getRoutingSuccess()) {
+                    r->write(os, altos, typeos, options);
+                }
+            }
+            ++routables;
+        } else {
+            os.writePreformattedTag(container->second);
+            if (altos != 0) {
+                altos->writePreformattedTag(container->second);
+            }
+            ++container;
+        }
+    }
+    if (remove) {
+        myKeptRoutables.clear();
+        myKeptContainers.clear();
+    }
+}
+
+
 bool
 RONet::furtherStored() {
     return myRoutables.size() > 0 || (myFlows.size() > 0 && myHaveActiveFlows) || myContainers.size() > 0;
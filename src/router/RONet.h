@@ -370,6 +370,51 @@ public:
     //@}
 
 
+    /// @name Iterative routing
+    //@{
+
+    /** @brief Sets whether processed vehicles, persons and containers shall be kept instead of written
+     *
+     * If set, saveAndRemoveRoutesUntil computes the routes as usual but keeps
+     *  the results in memory for further iterations, see rerouteKept and writeKept.
+     *
+     * @param[in] value Whether to keep processed routables
+     */
+    void setKeepRoutables(const bool value) {
+        myKeepRoutables = value;
+    }
+
+
+    /** @brief Computes the routes of all kept vehicles again
+     *
+     * The new routes are added to the vehicles' route alternatives using the
+     *  current edge weights. Persons keep the plans computed before.
+     *
+     * @param[in] options The options used during this process
+     * @param[in] provider The router provider for routes computation
+     */
+    void rerouteKept(OptionsCont& options, const RORouterProvider& provider);
+
+
+    /** @brief Writes the current routes of the kept vehicles, persons and containers
+     *
+     * The routables are written sorted by departure including their vehicle
+     *  types and are kept afterwards.
+     *
+     * @param[in] os The output device to write into
+     * @param[in] options The options used during this process
+     */
+    void writeKept(OutputDevice& os, OptionsCont& options);
+
+
+    /** @brief Writes the kept vehicles, persons and containers into the outputs and removes them
+     *
+     * @param[in] options The options used during this process
+     */
+    void saveAndRemoveKept(OptionsCont& options);
+    //@}
+
+
     /** @brief Opens the output for computed routes
      *
      * If one of the file outputs can not be build, an IOError is thrown.
@@ -450,6 +495,14 @@ private:
 
     void createBulkRouteRequests(const RORouterProvider& provider, const SUMOTime time, const bool removeLoops);
 
+    /// @brief writes the kept routables sorted by departure, optionally counting and removing them
+    void writeKeptRoutables(OutputDevice& os, OutputDevice* const altos, OutputDevice* const typeos,
+                            OptionsCont& options, const bool remove);
+
+    /// @brief writes the routable (if it was routed successfully), updates the statistics and deletes it
+    void writeAndRemove(const RORoutable* const r, OutputDevice& os, OutputDevice* const altos,
+                        OutputDevice* const typeos, OptionsCont& options);
+
 private:
     /// @brief Unique instance of RONet
     static RONet* myInstance;
@@ -502,6 +555,15 @@ private:
     typedef std::multimap<const SUMOTime, const std::string> ContainerMap;
     ContainerMap myContainers;
 
+    /// @brief whether processed routables are kept for further iterations
+    bool myKeepRoutables;
+
+    /// @brief routables which were processed and kept for further iterations
+    RoutablesMap myKeptRoutables;
+
+    /// @brief containers which were processed and kept for further iterations
+    ContainerMap myKeptContainers;
+
     /// @brief vehicles to keep for public transport routing
     std::vector<const RORoutable*> myPTVehicles;
 
@@ -398,6 +398,17 @@ RORouteDef::copy(const std::string& id, const SUMOTime stopOffset) const {
 }
 
 
+void
+RORouteDef::prepareRerouting(const bool tryRepair) {
+    myPrecomputed = 0;
+    myNewRoute = false;
+    if (myMayBeDisconnected) {
+        myMayBeDisconnected = false;
+        myTryRepair = tryRepair;
+    }
+}
+
+
 double
 RORouteDef::getOverallProb() const {
     double sum = 0.;
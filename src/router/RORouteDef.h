@@ -144,6 +144,16 @@ public:
     /** @brief Returns the sum of the probablities of the contained routes */
     double getOverallProb() const;
 
+    /** @brief Prepares the route definition for being routed again
+     *
+     * Forgets the route computed before. Definitions which stem from trips
+     *  (and now contain the route found before) are afterwards treated like
+     *  loaded routes, so that new routes are added as alternatives.
+     *
+     * @param[in] tryRepair Whether former trips shall be repaired instead
+     */
+    void prepareRerouting(const bool tryRepair);
+
     static void setUsingJTRR() {
         myUsingJTRR = true;
     }
@@ -164,8 +174,8 @@ protected:
     /// @brief Information whether a new route was generated
     mutable bool myNewRoute;
 
-    const bool myTryRepair;
-    const bool myMayBeDisconnected;
+    bool myTryRepair;
+    bool myMayBeDisconnected;
 
     static bool myUsingJTRR;
 
@@ -36,6 +36,7 @@
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/xml/SUMOXMLDefinitions.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/common/StringTokenizer.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/options/OptionsCont.h>
@@ -328,6 +329,12 @@ RORouteHandler::myEndElement(int element) {
 }
 
 
+void
+RORouteHandler::myCheckBinaryEdges(const std::vector<std::string>& edgeIDs, const std::vector<std::vector<int> >& successors) {
+    FileHelpers::checkEdgeHeader<ROEdge>(edgeIDs, successors, getFileName());
+}
+
+
 void
 RORouteHandler::closeRoute(const bool mayBeDisconnected) {
     if (myActiveRoute.size() == 0) {
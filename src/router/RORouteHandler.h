@@ -93,6 +93,17 @@ protected:
      * @see GenericSAXHandler::myEndElement
      */
     virtual void myEndElement(int element);
+
+
+    /** @brief Checks that a binary route file was written for the loaded network
+     *
+     * @param[in] edgeIDs The ids of the edges by their numerical id in the file
+     * @param[in] successors The numerical ids of the successors of each edge in the file
+     * @exception ProcessError If the edges do not match
+     * @see GenericSAXHandler::myCheckBinaryEdges
+     */
+    void myCheckBinaryEdges(const std::vector<std::string>& edgeIDs,
+                            const std::vector<std::vector<int> >& successors);
     //@}
 
 
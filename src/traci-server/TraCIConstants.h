@@ -843,6 +843,12 @@
 // triggers saving simulation state (set: simulation)
 #define CMD_SAVE_SIMSTATE 0x95
 
+// keeps the simulation state in memory (set: simulation)
+#define CMD_SAVE_SNAPSHOT 0x96
+
+// resets the simulation to a state kept in memory (set: simulation)
+#define CMD_RESTORE_SNAPSHOT 0x97
+
 // sets/retrieves abstract parameter
 #define VAR_PARAMETER 0x7e
 
@@ -308,7 +308,9 @@ TraCIServerAPI_Simulation::processSet(TraCIServer& server, tcpip::Storage& input
     // variable
     int variable = inputStorage.readUnsignedByte();
     if (variable != CMD_CLEAR_PENDING_VEHICLES
-            && variable != CMD_SAVE_SIMSTATE) {
+            && variable != CMD_SAVE_SIMSTATE
+            && variable != CMD_SAVE_SNAPSHOT
+            && variable != CMD_RESTORE_SNAPSHOT) {
         return server.writeErrorStatusCmd(CMD_SET_SIM_VARIABLE, "Set Simulation Variable: unsupported variable " + toHex(variable, 2) + " specified", outputStorage);
     }
     // id
@@ -334,6 +336,22 @@ TraCIServerAPI_Simulation::processSet(TraCIServer& server, tcpip::Storage& input
                 MSStateHandler::saveState(file, MSNet::getInstance()->getCurrentTimeStep());
             }
             break;
+            case CMD_SAVE_SNAPSHOT: {
+                std::string snapshotID;
+                if (!server.readTypeCheckingString(inputStorage, snapshotID)) {
+                    return server.writeErrorStatusCmd(CMD_SET_SIM_VARIABLE, "A string is needed for saving a snapshot.", outputStorage);
+                }
+                libsumo::Simulation::saveSnapshot(snapshotID);
+            }
+            break;
+            case CMD_RESTORE_SNAPSHOT: {
+                std::string snapshotID;
+                if (!server.readTypeCheckingString(inputStorage, snapshotID)) {
+                    return server.writeErrorStatusCmd(CMD_SET_SIM_VARIABLE, "A string is needed for restoring a snapshot.", outputStorage);
+                }
+                libsumo::Simulation::restoreSnapshot(snapshotID);
+            }
+            break;
             default:
                 break;
         }
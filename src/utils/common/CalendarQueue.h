@@ -0,0 +1,235 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    CalendarQueue.h
+/// @date    October 2026
+/// @version $Id$
+///
+// A priority queue for time stamped values using time buckets
+/****************************************************************************/
+#ifndef CalendarQueue_h
+#define CalendarQueue_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+#include <utils/common/StdDefs.h>
+#include <utils/common/SUMOTime.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class CalendarQueue
+ * @brief A priority queue for time stamped values using time buckets
+ *
+ * The near future is covered by a ring of buckets of a fixed width (usually
+ *  one simulation step). Values are appended to their bucket in constant time
+ *  and a bucket is only sorted when it becomes the current one. Values beyond
+ *  the ring are kept in an overflow heap and moved to their bucket as soon as
+ *  the ring reaches them. Values for the past (e.g. negative times) are
+ *  treated as due immediately.
+ *
+ * Values with the same time are returned in the order they were added.
+ */
+template<class T>
+class CalendarQueue {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] width The time span covered by a bucket
+     * @param[in] numBuckets The number of buckets in the ring
+     */
+    CalendarQueue(const SUMOTime width = DELTA_T, const int numBuckets = 1024) :
+        myWidth(MAX2(SUMOTime(1), width)), myBuckets(MAX2(1, numBuckets)),
+        myCurrent(0), myFront(0), myBase(0), myNumBucketed(0), mySequence(0) {}
+
+    /// @brief Returns whether no values are stored
+    bool empty() const {
+        return myNumBucketed + (int)myOverflow.size() == 0;
+    }
+
+    /// @brief Returns the number of stored values
+    int size() const {
+        return myNumBucketed + (int)myOverflow.size();
+    }
+
+    /** @brief Adds a value
+     *
+     * @param[in] time The time the value is due
+     * @param[in] value The value to add
+     */
+    void push(const SUMOTime time, const T& value) {
+        const Entry e(time, mySequence++, value);
+        if (time >= getWindowEnd()) {
+            myOverflow.push_back(e);
+            std::push_heap(myOverflow.begin(), myOverflow.end(), HeapComparator());
+            return;
+        }
+        std::vector<Entry>& bucket = myBuckets[getBucket(time)];
+        if (&bucket == &myBuckets[myCurrent]) {
+            // the current bucket is kept sorted
+            bucket.insert(std::upper_bound(bucket.begin() + myFront, bucket.end(), e, EntryComparator()), e);
+        } else {
+            bucket.push_back(e);
+        }
+        myNumBucketed++;
+    }
+
+    /** @brief Returns the time of the next value
+     * @note the queue must not be empty
+     */
+    SUMOTime topTime() {
+        advance();
+        return myBuckets[myCurrent][myFront].time;
+    }
+
+    /** @brief Removes and returns the next value
+     * @note the queue must not be empty
+     */
+    T pop() {
+        advance();
+        myNumBucketed--;
+        return myBuckets[myCurrent][myFront++].value;
+    }
+
+    /** @brief Removes a value which was added for the given time
+     *
+     * @param[in] time The time the value was added for
+     * @param[in] value The value to remove
+     * @return Whether the value was found
+     */
+    bool remove(const SUMOTime time, const T& value) {
+        if (time >= getWindowEnd()) {
+            for (typename std::vector<Entry>::iterator i = myOverflow.begin(); i != myOverflow.end(); ++i) {
+                if (i->time == time && i->value == value) {
+                    myOverflow.erase(i);
+                    std::make_heap(myOverflow.begin(), myOverflow.end(), HeapComparator());
+                    return true;
+                }
+            }
+            return false;
+        }
+        const int index = getBucket(time);
+        std::vector<Entry>& bucket = myBuckets[index];
+        for (typename std::vector<Entry>::iterator i = bucket.begin() + (index == myCurrent ? myFront : 0); i != bucket.end(); ++i) {
+            if (i->time == time && i->value == value) {
+                bucket.erase(i);
+                myNumBucketed--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    /// @brief A stored value with its time and insertion number
+    struct Entry {
+        Entry(const SUMOTime t, const long long int s, const T& v) : time(t), sequence(s), value(v) {}
+        SUMOTime time;
+        long long int sequence;
+        T value;
+    };
+
+    /// @brief sorts by time and insertion order
+    class EntryComparator {
+    public:
+        bool operator()(const Entry& e1, const Entry& e2) const {
+            return e1.time < e2.time || (e1.time == e2.time && e1.sequence < e2.sequence);
+        }
+    };
+
+    /// @brief inverse order for the min heap
+    class HeapComparator {
+    public:
+        bool operator()(const Entry& e1, const Entry& e2) const {
+            return EntryComparator()(e2, e1);
+        }
+    };
+
+    /// @brief the first time not covered by the buckets
+    SUMOTime getWindowEnd() const {
+        return myBase + myWidth * (SUMOTime)myBuckets.size();
+    }
+
+    /// @brief the bucket for a time within the window (past times go to the current bucket)
+    int getBucket(const SUMOTime time) const {
+        if (time < myBase) {
+            return myCurrent;
+        }
+        return (int)((myCurrent + (time - myBase) / myWidth) % (SUMOTime)myBuckets.size());
+    }
+
+    /// @brief moves the ring forward until the current bucket contains the next value
+    void advance() {
+        assert(!empty());
+        while (myFront == (int)myBuckets[myCurrent].size()) {
+            myBuckets[myCurrent].clear();
+            myFront = 0;
+            if (myNumBucketed == 0) {
+                // skip the empty buckets
+                const SUMOTime next = myOverflow.front().time;
+                myBase = next - (next % myWidth + myWidth) % myWidth;
+            } else {
+                myCurrent = (myCurrent + 1) % (int)myBuckets.size();
+                myBase += myWidth;
+            }
+            const SUMOTime windowEnd = getWindowEnd();
+            while (!myOverflow.empty() && myOverflow.front().time < windowEnd) {
+                std::pop_heap(myOverflow.begin(), myOverflow.end(), HeapComparator());
+                myBuckets[getBucket(myOverflow.back().time)].push_back(myOverflow.back());
+                myOverflow.pop_back();
+                myNumBucketed++;
+            }
+            std::sort(myBuckets[myCurrent].begin(), myBuckets[myCurrent].end(), EntryComparator());
+        }
+    }
+
+private:
+    /// @brief the time span of a bucket
+    SUMOTime myWidth;
+
+    /// @brief the ring of buckets
+    std::vector<std::vector<Entry> > myBuckets;
+
+    /// @brief the index of the bucket for the current time
+    int myCurrent;
+
+    /// @brief the position of the next value in the current bucket
+    int myFront;
+
+    /// @brief the begin of the time span of the current bucket
+    SUMOTime myBase;
+
+    /// @brief the number of values in the buckets (excluding the popped ones)
+    int myNumBucketed;
+
+    /// @brief the values beyond the buckets as a min heap
+    std::vector<Entry> myOverflow;
+
+    /// @brief the insertion counter for keeping the order of values with the same time
+    long long int mySequence;
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -36,6 +36,7 @@
 #include <unistd.h>
 #endif
 #include <fstream>
+#include <sys/stat.h>
 #include "FileHelpers.h"
 #include "StringTokenizer.h"
 #include "MsgHandler.h"
@@ -62,6 +63,32 @@ FileHelpers::isReadable(std::string path) {
 }
 
 
+bool
+FileHelpers::isUpToDate(const std::string& path, const std::string& reference) {
+    struct stat pathStat;
+    struct stat referenceStat;
+    if (stat(path.c_str(), &pathStat) != 0 || stat(reference.c_str(), &referenceStat) != 0) {
+        return false;
+    }
+#ifdef _MSC_VER
+    return pathStat.st_mtime >= referenceStat.st_mtime;
+#else
+    // seconds are too coarse for a file which was modified right after writing the other one
+#ifdef __APPLE__
+    const struct timespec& pathTime = pathStat.st_mtimespec;
+    const struct timespec& referenceTime = referenceStat.st_mtimespec;
+#else
+    const struct timespec& pathTime = pathStat.st_mtim;
+    const struct timespec& referenceTime = referenceStat.st_mtim;
+#endif
+    if (pathTime.tv_sec != referenceTime.tv_sec) {
+        return pathTime.tv_sec > referenceTime.tv_sec;
+    }
+    return pathTime.tv_nsec >= referenceTime.tv_nsec;
+#endif
+}
+
+
 // ---------------------------------------------------------------------------
 // file path evaluating functions
 // ---------------------------------------------------------------------------
@@ -54,6 +54,15 @@ public:
      * @return Whether the named file is readable
      */
     static bool isReadable(std::string path);
+
+    /** @brief Checks whether the given file exists and was not modified before the reference file
+     *
+     * @param[in] path The path to the file that shall be examined
+     * @param[in] reference The path to the file to compare with
+     * @return Whether the named file is at least as recent as the reference
+     * @note The modification times are compared with nanosecond resolution where the platform provides it
+     */
+    static bool isUpToDate(const std::string& path, const std::string& reference);
     //@}
 
 
@@ -205,6 +214,17 @@ public:
      */
     template <typename E>
     static void readEdgeVector(std::istream& in, std::vector<const E*>& edges, const std::string& rid);
+
+
+    /** @brief Checks that the edge header of a binary file matches the loaded edges
+     *
+     * @param[in] edgeIDs The ids of the edges by their numerical id in the file
+     * @param[in] successors The numerical ids of the successors of each edge in the file
+     * @param[in] file The name of the file for the error message
+     * @exception ProcessError If an edge or the order of its successors differs
+     */
+    template <typename E>
+    static void checkEdgeHeader(const std::vector<std::string>& edgeIDs, const std::vector<std::vector<int> >& successors, const std::string& file);
     //@}
 
 
@@ -313,6 +333,25 @@ void FileHelpers::readEdgeVector(std::istream& in, std::vector<const E*>& edges,
         }
     }
 }
+
+
+template <typename E>
+void FileHelpers::checkEdgeHeader(const std::vector<std::string>& edgeIDs, const std::vector<std::vector<int> >& successors, const std::string& file) {
+    const std::vector<E*>& loaded = E::getAllEdges();
+    if (edgeIDs.size() > loaded.size() || successors.size() != edgeIDs.size()) {
+        throw ProcessError("The binary file '" + file + "' was written for a different network.");
+    }
+    for (int i = 0; i < (int)edgeIDs.size(); i++) {
+        const E* const edge = loaded[i];
+        bool ok = edge != 0 && edge->getID() == edgeIDs[i] && edge->getNumSuccessors() == (int)successors[i].size();
+        for (int j = 0; ok && j < (int)successors[i].size(); j++) {
+            ok = edge->getSuccessors()[j]->getNumericalID() == successors[i][j];
+        }
+        if (!ok) {
+            throw ProcessError("The binary file '" + file + "' was written for a different network (edge '" + edgeIDs[i] + "' differs).");
+        }
+    }
+}
 #endif
 
 /****************************************************************************/
@@ -46,6 +46,7 @@ MsgHandler* MsgHandler::myWarningInstance = 0;
 MsgHandler* MsgHandler::myMessageInstance = 0;
 bool MsgHandler::myAmProcessingProcess = false;
 AbstractMutex* MsgHandler::myLock = 0;
+thread_local MsgHandler::MessageBuffer* MsgHandler::myThreadBuffer = 0;
 
 
 // ===========================================================================
@@ -80,6 +81,10 @@ MsgHandler::getErrorInstance() {
 
 void
 MsgHandler::inform(std::string msg, bool addType) {
+    if (myThreadBuffer != 0) {
+        myThreadBuffer->push_back(std::make_pair(this, build(msg, addType)));
+        return;
+    }
     if (myLock != 0) {
         myLock->lock();
     }
@@ -275,6 +280,21 @@ MsgHandler::assignLock(AbstractMutex* lock) {
 }
 
 
+void
+MsgHandler::setThreadBuffer(MessageBuffer* buffer) {
+    myThreadBuffer = buffer;
+}
+
+
+void
+MsgHandler::flushBuffer(MessageBuffer& buffer) {
+    for (MessageBuffer::const_iterator i = buffer.begin(); i != buffer.end(); ++i) {
+        i->first->inform(i->second, false);
+    }
+    buffer.clear();
+}
+
+
 
 /****************************************************************************/
 
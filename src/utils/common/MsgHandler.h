@@ -111,6 +111,22 @@ public:
         The lock will not be deleted */
     static void assignLock(AbstractMutex* lock);
 
+    /// @brief messages recorded by a thread together with the handler they were sent to
+    typedef std::vector<std::pair<MsgHandler*, std::string> > MessageBuffer;
+
+    /** @brief Lets the calling thread record its messages instead of writing them
+     *
+     * Worker threads use this to make their messages appear in a deterministic order
+     *  (see flushBuffer).
+     * @param[in] buffer The buffer to record to (0 to write the messages directly again)
+     */
+    static void setThreadBuffer(MessageBuffer* buffer);
+
+    /** @brief Writes the recorded messages in the order they were recorded and clears the buffer
+     * @param[in] buffer The buffer to write
+     */
+    static void flushBuffer(MessageBuffer& buffer);
+
     /** @brief Generic output operator
      * @return The MsgHandler for further processing
      */
@@ -168,6 +184,9 @@ private:
         The lock will not be deleted */
     static AbstractMutex* myLock;
 
+    /// @brief The buffer the messages of the current thread are recorded to (0 if written directly)
+    static thread_local MessageBuffer* myThreadBuffer;
+
 private:
     /// The type of the instance
     MsgType myType;
@@ -58,6 +58,11 @@ public:
     /// @brief Reads the given random number options and initialises the random number generator in accordance
     static void initRandGlobal(std::mt19937* which = 0);
 
+    /// @brief Returns the default random number generator
+    static std::mt19937* getRNG() {
+        return &myRandomNumberGenerator;
+    }
+
     /// @brief Returns a random real number in [0, 1)
     static inline double rand(std::mt19937* rng = 0) {
         if (rng == 0) {
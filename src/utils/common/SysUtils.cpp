@@ -25,13 +25,17 @@
 #endif
 
 #include <stdlib.h>
+#include <chrono>
 #include "SysUtils.h"
 
 #ifndef WIN32
+#include <unistd.h>
 #include <sys/time.h>
+#include <sys/resource.h>
 #else
 #define NOMINMAX
 #include <windows.h>
+#include <psapi.h>
 #undef NOMINMAX
 #endif
 
@@ -56,6 +60,68 @@ SysUtils::getCurrentMillis() {
 }
 
 
+long long int
+SysUtils::getCurrentMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+long long int
+SysUtils::getCurrentCPUMicros() {
+#ifndef WIN32
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return ((long long int)usage.ru_utime.tv_sec + (long long int)usage.ru_stime.tv_sec) * 1000000
+           + (long long int)usage.ru_utime.tv_usec + (long long int)usage.ru_stime.tv_usec;
+#else
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+        return 0;
+    }
+    // reported in units of 100 nanoseconds
+    const long long int kernelTime = ((long long int)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime;
+    const long long int userTime = ((long long int)user.dwHighDateTime << 32) | user.dwLowDateTime;
+    return (kernelTime + userTime) / 10;
+#endif
+}
+
+
+long long int
+SysUtils::getPeakMemoryUsage() {
+#ifndef WIN32
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // reported in bytes
+    return (long long int)usage.ru_maxrss;
+#else
+    // reported in kilobytes
+    return (long long int)usage.ru_maxrss * 1024;
+#endif
+#else
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return (long long int)counters.PeakWorkingSetSize;
+#endif
+}
+
+
+long
+SysUtils::getProcessID() {
+#ifndef WIN32
+    return (long)getpid();
+#else
+    return (long)GetCurrentProcessId();
+#endif
+}
+
+
 #ifdef _MSC_VER
 long
 SysUtils::getWindowsTicks() {
@@ -43,6 +43,30 @@ public:
     static long getCurrentMillis();
 
 
+    /** @brief Returns the time of a monotonic clock in microseconds (for measuring durations)
+     * @return Current clock value
+     */
+    static long long int getCurrentMicros();
+
+
+    /** @brief Returns the processor time (user and system) used by this process so far in microseconds
+     * @return The processor time or 0 if it cannot be determined
+     */
+    static long long int getCurrentCPUMicros();
+
+
+    /** @brief Returns the peak memory (resident set size) used by this process so far
+     * @return The peak memory in bytes or 0 if it cannot be determined
+     */
+    static long long int getPeakMemoryUsage();
+
+
+    /** @brief Returns the id of this process
+     * @return The process id
+     */
+    static long getProcessID();
+
+
 #ifdef _MSC_VER
     /** @brief Returns the CPU ticks (windows only)
      *
@@ -165,6 +165,11 @@ public:
         myValues[-1] = std::make_pair(false, value);
     }
 
+    /// @brief Removes all stored values
+    void clear() {
+        myValues.clear();
+    }
+
 private:
     /// @brief Value of time line, indicating validity.
     typedef std::pair<bool, T> ValidValue;
@@ -31,6 +31,7 @@
 #include <vector>
 #include <limits>
 #include <cmath>
+#include <algorithm>
 #include <utils/common/StdDefs.h>
 #include <utils/geom/GeomHelper.h>
 #include <utils/common/SUMOVehicleClass.h>
@@ -90,6 +91,53 @@ public:
     }
 
 
+    /** @brief Computes all pollutants for a batch of vehicle states of the same emission class
+     *
+     * Evaluates the same functions as compute in a loop over the states without virtual calls,
+     *  computing the speed conversion and the acceleration angle only once per state.
+     *
+     * @param[in] c emission class for the function parameters to use
+     * @param[in] n The number of vehicle states
+     * @param[in] v The velocities
+     * @param[in] a The accelerations
+     * @param[in] slope The road's slopes at the vehicle positions [deg] (unused)
+     * @param[in] param Additional model parameters (unused)
+     * @param[out] into The array of n results
+     */
+    void computeAll(const SUMOEmissionClass c, const int n, const double* const v, const double* const a, const double* const slope,
+                    const std::map<int, double>* param, PollutantsInterface::Emissions* const into) const {
+        UNUSED_PARAMETER(slope);
+        UNUSED_PARAMETER(param);
+        if (c == PollutantsInterface::ZERO_EMISSIONS) {
+            std::fill(into, into + n, PollutantsInterface::Emissions());
+            return;
+        }
+        const int index = (c & ~PollutantsInterface::HEAVY_BIT) - 1;
+        double values[6];
+        for (int i = 0; i < n; i++) {
+            const double kmh = v[i] * 3.6;
+            if (index >= 42) {
+                for (int e = 0; e < 6; e++) {
+                    const double* f = myFunctionParameter[index - 42] + 6 * e;
+                    const double scale = (e == PollutantsInterface::FUEL) ? 3.6 * 790. : 3.6;
+                    values[e] = (double) MAX2((f[0] + f[3] * kmh + f[4] * kmh * kmh + f[5] * kmh * kmh * kmh) / scale, 0.);
+                }
+            } else if (a[i] < 0.) {
+                std::fill(values, values + 6, 0.);
+            } else {
+                const double alpha = asin(a[i] / 9.81) * 180. / M_PI;
+                for (int e = 0; e < 6; e++) {
+                    const double* f = myFunctionParameter[index] + 6 * e;
+                    const double scale = (e == PollutantsInterface::FUEL) ? 3.6 * 790. : 3.6;
+                    values[e] = (double) MAX2((f[0] + f[1] * alpha * kmh + f[2] * alpha * alpha * kmh + f[3] * kmh + f[4] * kmh * kmh + f[5] * kmh * kmh * kmh) / scale, 0.);
+                }
+            }
+            into[i] = PollutantsInterface::Emissions(values[PollutantsInterface::CO2], values[PollutantsInterface::CO], values[PollutantsInterface::HC],
+                      values[PollutantsInterface::FUEL], values[PollutantsInterface::NO_X], values[PollutantsInterface::PM_X]);
+        }
+    }
+
+
 private:
     /// @brief The function parameter
     static double myFunctionParameter[42][36];
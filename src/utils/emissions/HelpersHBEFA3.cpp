@@ -471,6 +471,14 @@ HelpersHBEFA3::HelpersHBEFA3() : PollutantsInterface::Helper("HBEFA3") {
         index++;
     }
     myEmissionClassStrings.addAlias("unknown", myEmissionClassStrings.get("PC_G_EU4"));
+    // the fuel type is evaluated once instead of on every fuel computation
+    std::vector<SUMOEmissionClass> classes;
+    addAllClassesInto(classes);
+    for (std::vector<SUMOEmissionClass>::const_iterator c = classes.begin(); c != classes.end(); ++c) {
+        if (*c != HBEFA3_BASE) {
+            myFuelDensity[(*c & ~PollutantsInterface::HEAVY_BIT) - HBEFA3_BASE - 1] = getFuel(*c) == "Diesel" ? 836. : 742.;
+        }
+    }
 }
 
 
@@ -31,6 +31,7 @@
 #include <vector>
 #include <limits>
 #include <cmath>
+#include <algorithm>
 #include <utils/common/StdDefs.h>
 #include <utils/geom/GeomHelper.h>
 #include <utils/common/SUMOVehicleClass.h>
@@ -109,23 +110,59 @@ public:
             return 0.;
         }
         const int index = (c & ~PollutantsInterface::HEAVY_BIT) - HBEFA3_BASE - 1;
-        double scale = 3.6;
-        if (e == PollutantsInterface::FUEL) {
-            if (getFuel(c) == "Diesel") {
-                scale *= 836.;
+        const double scale = e == PollutantsInterface::FUEL ? 3.6 * myFuelDensity[index] : 3.6;
+        return evaluate(myFunctionParameter[index][e], v, a, scale);
+    }
+
+
+    /** @brief Computes all pollutants for a batch of vehicle states of the same emission class
+     *
+     * Evaluates the same functions as compute in a loop over the states without virtual calls.
+     *
+     * @param[in] c emission class for the function parameters to use
+     * @param[in] n The number of vehicle states
+     * @param[in] v The velocities
+     * @param[in] a The accelerations
+     * @param[in] slope The road's slopes at the vehicle positions [deg] (unused)
+     * @param[in] param Additional model parameters (unused)
+     * @param[out] into The array of n results
+     */
+    void computeAll(const SUMOEmissionClass c, const int n, const double* const v, const double* const a, const double* const slope,
+                    const std::map<int, double>* param, PollutantsInterface::Emissions* const into) const {
+        UNUSED_PARAMETER(slope);
+        UNUSED_PARAMETER(param);
+        if (c == HBEFA3_BASE) {
+            std::fill(into, into + n, PollutantsInterface::Emissions());
+            return;
+        }
+        const int index = (c & ~PollutantsInterface::HEAVY_BIT) - HBEFA3_BASE - 1;
+        const double(*f)[6] = myFunctionParameter[index];
+        const double fuelScale = 3.6 * myFuelDensity[index];
+        for (int i = 0; i < n; i++) {
+            if (a[i] < 0.) {
+                into[i] = PollutantsInterface::Emissions();
             } else {
-                scale *= 742.;
+                into[i] = PollutantsInterface::Emissions(evaluate(f[PollutantsInterface::CO2], v[i], a[i], 3.6), evaluate(f[PollutantsInterface::CO], v[i], a[i], 3.6),
+                          evaluate(f[PollutantsInterface::HC], v[i], a[i], 3.6), evaluate(f[PollutantsInterface::FUEL], v[i], a[i], fuelScale),
+                          evaluate(f[PollutantsInterface::NO_X], v[i], a[i], 3.6), evaluate(f[PollutantsInterface::PM_X], v[i], a[i], 3.6));
             }
         }
-        const double* f = myFunctionParameter[index][e];
-        return (double) MAX2((f[0] + f[1] * a * v + f[2] * a * a * v + f[3] * v + f[4] * v * v + f[5] * v * v * v) / scale, 0.);
     }
 
 
+private:
+    /// @brief evaluates the emission function with the given parameters
+    static inline double evaluate(const double* const f, const double v, const double a, const double scale) {
+        return (double) MAX2((f[0] + f[1] * a * v + f[2] * a * a * v + f[3] * v + f[4] * v * v + f[5] * v * v * v) / scale, 0.);
+    }
+
 private:
     /// @brief The function parameter
     static double myFunctionParameter[45][6][6];
 
+    /// @brief The fuel density per emission class (depending on the fuel type)
+    double myFuelDensity[45];
+
 };
 
 
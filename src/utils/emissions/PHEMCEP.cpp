@@ -31,7 +31,6 @@
 #include <cmath>
 #include <string>
 #include <utils/common/StdDefs.h>
-#include <utils/common/StringBijection.h>
 #include <utils/common/UtilExceptions.h>
 #include "PHEMCEP.h"
 
@@ -112,6 +111,8 @@ PHEMCEP::PHEMCEP(bool heavyVehicle, SUMOEmissionClass emissionClass, const std::
         _speedCurveRotational.push_back(matrixSpeedRotational[i][1]);
         _gearTransmissionCurve.push_back(matrixSpeedRotational[i][2]);
     } // end for
+    _speedPatternRotationalGrid.build(_speedPatternRotational);
+    _gearTransmissionCurveGrid.build(_gearTransmissionCurve);
 
     // looping through matrix and assigning values for drag table
     _nNormTable.clear();
@@ -125,6 +126,8 @@ PHEMCEP::PHEMCEP(bool heavyVehicle, SUMOEmissionClass emissionClass, const std::
         _dragNormTable.push_back(normedDragTable[i][1]);
 
     } // end for
+    _nNormTableGrid.build(_nNormTable);
+    _dragNormTableGrid.build(_dragNormTable);
 
     // looping through matrix and assigning values for Fuel consumption
     _cepCurveFC.clear();
@@ -142,6 +145,8 @@ PHEMCEP::PHEMCEP(bool heavyVehicle, SUMOEmissionClass emissionClass, const std::
         _normedCepCurveFC.push_back(matrixFC[i][1]);
 
     } // end for
+    _powerPatternFCGrid.build(_powerPatternFC);
+    _normalizedPowerPatternFCGrid.build(_normalizedPowerPatternFC);
 
     _powerPatternPollutants.clear();
     double pollutantMultiplyer = 1;
@@ -176,10 +181,17 @@ PHEMCEP::PHEMCEP(bool heavyVehicle, SUMOEmissionClass emissionClass, const std::
         } // end for
     } // end for
 
+    _powerPatternPollutantsGrid.build(_powerPatternPollutants);
+    _normalizedPowerPatternPollutantsGrid.build(_normailzedPowerPatternPollutants);
+
     for (int i = 0; i < (int) headerLinePollutants.size(); i++) {
-        _cepCurvePollutants.insert(pollutantIdentifier[i], pollutantMeasures[i]);
-        _normalizedCepCurvePollutants.insert(pollutantIdentifier[i], normalizedPollutantMeasures[i]);
-        _idlingValuesPollutants.insert(pollutantIdentifier[i], idlingValuesPollutants[i] * pollutantMultiplyer);
+        if (_pollutantIndex.count(pollutantIdentifier[i]) > 0) {
+            throw InvalidArgument("Duplicate pollutant " + pollutantIdentifier[i] + " in vehicle file for: " + emissionClassIdentifier);
+        }
+        _pollutantIndex[pollutantIdentifier[i]] = i;
+        _cepCurvePollutants.push_back(pollutantMeasures[i]);
+        _normalizedCepCurvePollutants.push_back(normalizedPollutantMeasures[i]);
+        _idlingValuesPollutants.push_back(idlingValuesPollutants[i] * pollutantMultiplyer);
     } // end for
 
     _idlingFC = idlingFC * _ratedPower;
@@ -199,39 +211,50 @@ PHEMCEP::~PHEMCEP() {
 
 double
 PHEMCEP::GetEmission(const std::string& pollutant, double power, double speed, bool normalized) const {
-    std::vector<double> emissionCurve;
-    std::vector<double> powerPattern;
+    const bool isFC = pollutant == "FC";
+    std::map<std::string, int>::const_iterator index = _pollutantIndex.find(pollutant);
 
     if (!normalized && fabs(speed) <= ZERO_SPEED_ACCURACY) {
-        if (pollutant == "FC") {
+        if (isFC) {
             return _idlingFC;
+        } else if (index == _pollutantIndex.end()) {
+            throw InvalidArgument("String '" + pollutant + "' not found.");
         } else {
-            return _idlingValuesPollutants.get(pollutant);
+            return _idlingValuesPollutants[index->second];
         }
     } // end if
 
-    if (pollutant == "FC") {
+    const std::vector<double>* emissionCurvePtr;
+    const std::vector<double>* powerPatternPtr;
+    const PatternGrid* grid;
+    if (isFC) {
         if (normalized) {
-            emissionCurve = _normedCepCurveFC;
-            powerPattern = _normalizedPowerPatternFC;
+            emissionCurvePtr = &_normedCepCurveFC;
+            powerPatternPtr = &_normalizedPowerPatternFC;
+            grid = &_normalizedPowerPatternFCGrid;
         } else {
-            emissionCurve = _cepCurveFC;
-            powerPattern = _powerPatternFC;
+            emissionCurvePtr = &_cepCurveFC;
+            powerPatternPtr = &_powerPatternFC;
+            grid = &_powerPatternFCGrid;
         }
     } else {
-        if (!_cepCurvePollutants.hasString(pollutant)) {
+        if (index == _pollutantIndex.end()) {
             throw InvalidArgument("Emission pollutant " + pollutant + " not found!");
         }
 
         if (normalized) {
-            emissionCurve = _normalizedCepCurvePollutants.get(pollutant);
-            powerPattern = _normailzedPowerPatternPollutants;
+            emissionCurvePtr = &_normalizedCepCurvePollutants[index->second];
+            powerPatternPtr = &_normailzedPowerPatternPollutants;
+            grid = &_normalizedPowerPatternPollutantsGrid;
         } else {
-            emissionCurve = _cepCurvePollutants.get(pollutant);
-            powerPattern = _powerPatternPollutants;
+            emissionCurvePtr = &_cepCurvePollutants[index->second];
+            powerPatternPtr = &_powerPatternPollutants;
+            grid = &_powerPatternPollutantsGrid;
         }
 
     } // end if
+    const std::vector<double>& emissionCurve = *emissionCurvePtr;
+    const std::vector<double>& powerPattern = *powerPatternPtr;
 
 
 
@@ -260,11 +283,11 @@ PHEMCEP::GetEmission(const std::string& pollutant, double power, double speed, b
         return PHEMCEP::Interpolate(power, powerPattern[powerPattern.size() - 2], powerPattern.back(), emissionCurve[emissionCurve.size() - 2], emissionCurve.back());
     } // end if
 
-    // bisection search to find correct position in power pattern
+    // search to find correct position in power pattern
     int upperIndex;
     int lowerIndex;
 
-    PHEMCEP::FindLowerUpperInPattern(lowerIndex, upperIndex, powerPattern, power);
+    PHEMCEP::FindLowerUpperInPattern(lowerIndex, upperIndex, powerPattern, *grid, power);
 
     return PHEMCEP::Interpolate(power, powerPattern[lowerIndex], powerPattern[upperIndex], emissionCurve[lowerIndex], emissionCurve[upperIndex]);
 
@@ -297,7 +320,7 @@ double PHEMCEP::GetDecelCoast(double speed, double acc, double gradient, double
     double n = (30 * speed * iTot) / ((_effictiveWheelDiameter / 2) * M_PI2);
     double nNorm = (n - _engineIdlingSpeed) / (_engineRatedSpeed - _engineIdlingSpeed);
 
-    FindLowerUpperInPattern(lowerIndex, upperIndex, _nNormTable, nNorm);
+    FindLowerUpperInPattern(lowerIndex, upperIndex, _nNormTable, _nNormTableGrid, nNorm);
 
     double fMot = 0;
 
@@ -324,7 +347,7 @@ PHEMCEP::GetRotationalCoeffecient(double speed) const {
     int upperIndex;
     int lowerIndex;
 
-    PHEMCEP::FindLowerUpperInPattern(lowerIndex, upperIndex, _speedPatternRotational, speed);
+    PHEMCEP::FindLowerUpperInPattern(lowerIndex, upperIndex, _speedPatternRotational, _speedPatternRotationalGrid, speed);
 
     return PHEMCEP::Interpolate(speed,
                                 _speedPatternRotational[lowerIndex],
@@ -337,7 +360,7 @@ double PHEMCEP::GetGearCoeffecient(double speed) const {
     int upperIndex;
     int lowerIndex;
 
-    FindLowerUpperInPattern(lowerIndex, upperIndex, _gearTransmissionCurve, speed);
+    FindLowerUpperInPattern(lowerIndex, upperIndex, _gearTransmissionCurve, _gearTransmissionCurveGrid, speed);
 
     return Interpolate(speed,
                        _speedPatternRotational[lowerIndex],
@@ -350,7 +373,7 @@ double PHEMCEP::GetDragCoeffecient(double nNorm)  const {
     int upperIndex;
     int lowerIndex;
 
-    FindLowerUpperInPattern(lowerIndex, upperIndex, _dragNormTable, nNorm);
+    FindLowerUpperInPattern(lowerIndex, upperIndex, _dragNormTable, _dragNormTableGrid, nNorm);
 
     return Interpolate(nNorm,
                        _nNormTable[lowerIndex],
@@ -359,7 +382,7 @@ double PHEMCEP::GetDragCoeffecient(double nNorm)  const {
                        _dragNormTable[upperIndex]);
 } // end of GetGearCoefficient
 
-void PHEMCEP::FindLowerUpperInPattern(int& lowerIndex, int& upperIndex, const std::vector<double>& pattern, double value) const {
+void PHEMCEP::FindLowerUpperInPattern(int& lowerIndex, int& upperIndex, const std::vector<double>& pattern, const PatternGrid& grid, double value) const {
     if (value <= pattern.front()) {
         lowerIndex = 0;
         upperIndex = 0;
@@ -373,6 +396,10 @@ void PHEMCEP::FindLowerUpperInPattern(int& lowerIndex, int& upperIndex, const st
         return;
     } // end if
 
+    if (grid.find(lowerIndex, upperIndex, pattern, value)) {
+        return;
+    }
+
     // bisection search to find correct position in power pattern
     int middleIndex = ((int)pattern.size() - 1) / 2;
     upperIndex = (int)pattern.size() - 1;
@@ -400,6 +427,56 @@ void PHEMCEP::FindLowerUpperInPattern(int& lowerIndex, int& upperIndex, const st
 } // end of FindLowerUpperInPattern
 
 
+void
+PHEMCEP::PatternGrid::build(const std::vector<double>& pattern) {
+    myCellLower.clear();
+    const int size = (int)pattern.size();
+    if (size < 3) {
+        return;
+    }
+    for (int i = 0; i < size - 1; i++) {
+        if (!(pattern[i] < pattern[i + 1])) {
+            // not strictly increasing, keep the bisection
+            return;
+        }
+    }
+    // a few cells per interval keep the remaining linear search short even for irregular patterns
+    const int numCells = 4 * (size - 1);
+    myMin = pattern.front();
+    myInvCellWidth = numCells / (pattern.back() - pattern.front());
+    int lower = 0;
+    for (int cell = 0; cell < numCells; cell++) {
+        const double cellStart = myMin + cell / myInvCellWidth;
+        while (lower < size - 2 && pattern[lower + 1] <= cellStart) {
+            lower++;
+        }
+        myCellLower.push_back(lower);
+    }
+}
+
+
+bool
+PHEMCEP::PatternGrid::find(int& lowerIndex, int& upperIndex, const std::vector<double>& pattern, double value) const {
+    if (myCellLower.empty()) {
+        return false;
+    }
+    const int size = (int)pattern.size();
+    const int cell = MIN2(MAX2((int)((value - myMin) * myInvCellWidth), 0), (int)myCellLower.size() - 1);
+    int lower = myCellLower[cell];
+    // correct rounding effects of the cell computation
+    while (lower > 0 && pattern[lower] > value) {
+        lower--;
+    }
+    while (lower < size - 2 && pattern[lower + 1] <= value) {
+        lower++;
+    }
+    lowerIndex = lower;
+    // an exact match yields a single index like in the bisection
+    upperIndex = pattern[lower] == value ? lower : lower + 1;
+    return true;
+}
+
+
 double
 PHEMCEP::CalcPower(double v, double a, double slope, double /* vehicleLoading */) const {
     const double rotFactor = GetRotationalCoeffecient(v);
@@ -29,9 +29,9 @@
 #include <config.h>
 #endif
 
+#include <map>
 #include <vector>
 #include <utils/common/SUMOVehicleClass.h>
-#include <utils/common/StringBijection.h>
 #include "PHEMCEP.h"
 #include "PHEMConstants.h"
 
@@ -52,6 +52,10 @@ enum NormalizingType {
 /**
  * @class PHEMCEP
  * @brief Data Handler for a single CEP emission data set
+ *
+ * All breakpoint patterns of the data set get a uniform grid on construction
+ *  which finds the interpolation interval for a value in constant time
+ *  (see PatternGrid) instead of a bisection per lookup.
  */
 class PHEMCEP {
 public:
@@ -229,6 +233,41 @@ public:
     }
 
 private:
+    /**
+     * @class PatternGrid
+     * @brief Uniform grid over a strictly increasing pattern, mapping each cell to the pattern interval of its start
+     *
+     * The bounding indices found are the same as the ones of the bisection search.
+     *  Patterns which are not strictly increasing get no grid.
+     */
+    class PatternGrid {
+    public:
+        /// @brief Constructor
+        PatternGrid() : myMin(0.), myInvCellWidth(0.) {}
+
+        /** @brief Builds the grid for the pattern
+         * @param[in] pattern The pattern to index
+         */
+        void build(const std::vector<double>& pattern);
+
+        /** @brief Finds bounding upper and lower index in pattern for a value strictly inside the pattern range
+         * @param[out] lowerIndex out variable for lower index
+         * @param[out] upperIndex out variable for upper index
+         * @param[in] pattern the pattern the grid was built for
+         * @param[in] value to search
+         * @return whether the grid could be used (was built successfully)
+         */
+        bool find(int& lowerIndex, int& upperIndex, const std::vector<double>& pattern, double value) const;
+
+    private:
+        /// @brief the first value of the pattern
+        double myMin;
+        /// @brief the number of cells per unit
+        double myInvCellWidth;
+        /// @brief the lower pattern index for the start of each cell
+        std::vector<int> myCellLower;
+    };
+
     /** @brief Interpolates emission linearly between two known power-emission pairs
      * @param[in] px power-value to interpolate
      * @param[in] p1 first known power value
@@ -243,9 +282,10 @@ private:
      * @param[out] lowerIndex out variable for lower index
      * @param[out] upperIndex out variable for lower index
      * @param[in] pattern to search
+     * @param[in] grid the grid built for the pattern
      * @param[in] value to search
      */
-    void FindLowerUpperInPattern(int& lowerIndex, int& upperIndex, const std::vector<double>& pattern, double value) const;
+    void FindLowerUpperInPattern(int& lowerIndex, int& upperIndex, const std::vector<double>& pattern, const PatternGrid& grid, double value) const;
 
     /** @brief Calculates rotational index for speed
      * @param[in] speed desired speed
@@ -320,9 +360,22 @@ private:
     std::vector<double> _gearTransmissionCurve;
     std::vector<double> _nNormTable;
     std::vector<double> _dragNormTable;
-    StringBijection< std::vector<double> > _cepCurvePollutants;
-    StringBijection<std::vector<double> > _normalizedCepCurvePollutants;
-    StringBijection<double> _idlingValuesPollutants;
+    /// @brief the index of the pollutants in the curves and idling values
+    std::map<std::string, int> _pollutantIndex;
+    std::vector<std::vector<double> > _cepCurvePollutants;
+    std::vector<std::vector<double> > _normalizedCepCurvePollutants;
+    std::vector<double> _idlingValuesPollutants;
+    /// @name the grids for the patterns above
+    /// @{
+    PatternGrid _speedPatternRotationalGrid;
+    PatternGrid _powerPatternFCGrid;
+    PatternGrid _powerPatternPollutantsGrid;
+    PatternGrid _normalizedPowerPatternFCGrid;
+    PatternGrid _normalizedPowerPatternPollutantsGrid;
+    PatternGrid _gearTransmissionCurveGrid;
+    PatternGrid _nNormTableGrid;
+    PatternGrid _dragNormTableGrid;
+    /// @}
 
 };
 
@@ -28,6 +28,7 @@
 
 #include <limits>
 #include <cmath>
+#include <algorithm>
 #include <utils/common/SUMOVehicleClass.h>
 #include "HelpersHBEFA.h"
 #include "HelpersHBEFA3.h"
@@ -137,10 +138,46 @@ PollutantsInterface::compute(const SUMOEmissionClass c, const EmissionType e, co
 
 PollutantsInterface::Emissions
 PollutantsInterface::computeAll(const SUMOEmissionClass c, const double v, const double a, const double slope, const std::map<int, double>* param) {
-    const Helper* const h = myHelpers[c >> 16];
-    return Emissions(h->compute(c, CO2, v, a, slope, param), h->compute(c, CO, v, a, slope, param), h->compute(c, HC, v, a, slope, param),
-                     h->compute(c, FUEL, v, a, slope, param), h->compute(c, NO_X, v, a, slope, param), h->compute(c, PM_X, v, a, slope, param),
-                     h->compute(c, ELEC, v, a, slope, param));
+    Emissions result;
+    myHelpers[c >> 16]->computeAll(c, 1, &v, &a, &slope, param, &result);
+    return result;
+}
+
+
+void
+PollutantsInterface::computeAll(const std::vector<SUMOEmissionClass>& c, const std::vector<double>& v, const std::vector<double>& a,
+                                const std::vector<double>& slope, std::vector<Emissions>& into) {
+    const int n = (int)c.size();
+    into.resize(n);
+    // group the states by emission class
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&c](const int i1, const int i2) {
+        return c[i1] < c[i2];
+    });
+    std::vector<double> groupV, groupA, groupSlope;
+    std::vector<Emissions> groupResult;
+    for (int begin = 0; begin < n;) {
+        const SUMOEmissionClass eClass = c[order[begin]];
+        int end = begin;
+        groupV.clear();
+        groupA.clear();
+        groupSlope.clear();
+        while (end < n && c[order[end]] == eClass) {
+            groupV.push_back(v[order[end]]);
+            groupA.push_back(a[order[end]]);
+            groupSlope.push_back(slope[order[end]]);
+            end++;
+        }
+        groupResult.resize(end - begin);
+        myHelpers[eClass >> 16]->computeAll(eClass, end - begin, groupV.data(), groupA.data(), groupSlope.data(), 0, groupResult.data());
+        for (int i = begin; i < end; i++) {
+            into[order[i]] = groupResult[i - begin];
+        }
+        begin = end;
+    }
 }
 
 
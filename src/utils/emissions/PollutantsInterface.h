@@ -230,6 +230,27 @@ public:
          */
         virtual double compute(const SUMOEmissionClass c, const EmissionType e, const double v, const double a, const double slope, const std::map<int, double>* param) const = 0;
 
+        /** @brief Computes all pollutants for a batch of vehicle states of the same emission class
+         * Default implementation calls compute for every state and emission type, models may
+         *  override this to evaluate their functions in a tight loop sharing the common terms.
+         * @param[in] c The vehicle emission class
+         * @param[in] n The number of vehicle states
+         * @param[in] v The velocities
+         * @param[in] a The accelerations
+         * @param[in] slope The road's slopes at the vehicle positions [deg]
+         * @param[in] param Additional model parameters (shared by all states)
+         * @param[out] into The array of n results
+         */
+        virtual void computeAll(const SUMOEmissionClass c, const int n, const double* const v, const double* const a, const double* const slope,
+                                const std::map<int, double>* param, Emissions* const into) const {
+            for (int i = 0; i < n; i++) {
+                into[i] = Emissions(compute(c, CO2, v[i], a[i], slope[i], param), compute(c, CO, v[i], a[i], slope[i], param),
+                                    compute(c, HC, v[i], a[i], slope[i], param), compute(c, FUEL, v[i], a[i], slope[i], param),
+                                    compute(c, NO_X, v[i], a[i], slope[i], param), compute(c, PM_X, v[i], a[i], slope[i], param),
+                                    compute(c, ELEC, v[i], a[i], slope[i], param));
+            }
+        }
+
         /** @brief Returns the adapted acceleration value, useful for comparing with external PHEMlight references.
          * Default implementation returns always the input accel.
          * @param[in] c the emission class
@@ -369,6 +390,19 @@ public:
     static Emissions computeAll(const SUMOEmissionClass c, const double v, const double a, const double slope, const std::map<int, double>* param = 0);
 
 
+    /** @brief Returns the amount of all emitted pollutants for a batch of vehicle states (in mg/s or ml/s for fuel)
+     *
+     * The states are grouped by emission class and each group is computed by a single call to the model.
+     * @param[in] c The vehicle emission classes
+     * @param[in] v The vehicles' current velocities
+     * @param[in] a The vehicles' current accelerations
+     * @param[in] slope The road's slopes at the vehicles' positions [deg]
+     * @param[out] into The amounts emitted by the vehicles (in the order of the input)
+     */
+    static void computeAll(const std::vector<SUMOEmissionClass>& c, const std::vector<double>& v, const std::vector<double>& a,
+                           const std::vector<double>& slope, std::vector<Emissions>& into);
+
+
     /** @brief Returns the amount of emitted pollutant given the vehicle type and default values for the state (in mg)
      * @param[in] c The vehicle emission class
      * @param[in] e the type of emission (CO, CO2, ...)
@@ -27,7 +27,9 @@
 #endif
 
 #include <string>
+#include <cstring>
 #include <utils/common/StdDefs.h>
+#include <utils/common/UtilExceptions.h>
 #include <utils/geom/Position.h>
 #include "BinaryFormatter.h"
 #include "BinaryInputDevice.h"
@@ -42,9 +44,10 @@
 // method definitions
 // ===========================================================================
 BinaryInputDevice::BinaryInputDevice(const std::string& name,
-                                     const bool isTyped, const bool doValidate)
+                                     const bool isTyped, const bool doValidate, const int chunkSize)
     : myStream(name.c_str(), std::fstream::in | std::fstream::binary),
-      myAmTyped(isTyped), myEnableValidation(doValidate) {}
+      myAmTyped(isTyped), myEnableValidation(doValidate),
+      myChunk(MAX2(chunkSize, 2)), myChunkPos(0), myChunkEnd(0) {}
 
 
 BinaryInputDevice::~BinaryInputDevice() {}
@@ -52,26 +55,67 @@ BinaryInputDevice::~BinaryInputDevice() {}
 
 bool
 BinaryInputDevice::good() const {
-    return myStream.good();
+    return myChunkPos < myChunkEnd || myStream.good();
 }
 
 
 int
 BinaryInputDevice::peek() {
-    return myStream.peek();
+    if (myChunkPos == myChunkEnd) {
+        fillBuffer();
+        if (myChunkPos == myChunkEnd) {
+            return EOF;
+        }
+    }
+    return (unsigned char)myChunk[myChunkPos];
 }
 
 
 std::string
 BinaryInputDevice::read(int numBytes) {
-    myStream.read((char*) &myBuffer, sizeof(char)*numBytes);
+    readBytes(myBuffer, numBytes);
     return std::string(myBuffer, numBytes);
 }
 
 
 void
 BinaryInputDevice::putback(char c) {
-    myStream.putback(c);
+    if (myChunkPos == 0) {
+        throw ProcessError("Binary file is invalid, cannot put back a byte.");
+    }
+    myChunk[--myChunkPos] = c;
+}
+
+
+void
+BinaryInputDevice::readBytes(char* into, int numBytes) {
+    while (numBytes > 0) {
+        if (myChunkPos == myChunkEnd) {
+            fillBuffer();
+            if (myChunkPos == myChunkEnd) {
+                throw ProcessError("Binary file is invalid, unexpected end of file.");
+            }
+        }
+        const int available = MIN2(numBytes, myChunkEnd - myChunkPos);
+        memcpy(into, &myChunk[myChunkPos], available);
+        into += available;
+        myChunkPos += available;
+        numBytes -= available;
+    }
+}
+
+
+void
+BinaryInputDevice::fillBuffer() {
+    const int keep = myChunkPos > 0 ? 1 : 0;
+    const int remaining = myChunkEnd - myChunkPos + keep;
+    memmove(&myChunk[0], &myChunk[myChunkPos - keep], remaining);
+    myChunkPos = keep;
+    myChunkEnd = remaining;
+    if (myStream.good()) {
+        myStream.read(&myChunk[myChunkEnd], myChunk.size() - myChunkEnd);
+        myChunkEnd += (int)myStream.gcount();
+    }
 }
 
 
@@ -79,7 +123,7 @@ int
 BinaryInputDevice::checkType(BinaryFormatter::DataType t) {
     if (myAmTyped) {
         char c;
-        myStream.read(&c, sizeof(char));
+        readBytes(&c, sizeof(char));
         if (myEnableValidation && c != t) {
             throw ProcessError("Unexpected type.");
         }
@@ -92,7 +136,7 @@ BinaryInputDevice::checkType(BinaryFormatter::DataType t) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, char& c) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    os.myStream.read(&c, sizeof(char));
+    os.readBytes(&c, sizeof(char));
     return os;
 }
 
@@ -100,7 +144,7 @@ operator>>(BinaryInputDevice& os, char& c) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, unsigned char& c) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    os.myStream.read((char*) &c, sizeof(unsigned char));
+    os.readBytes((char*) &c, sizeof(unsigned char));
     return os;
 }
 
@@ -108,7 +152,7 @@ operator>>(BinaryInputDevice& os, unsigned char& c) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, int& i) {
     os.checkType(BinaryFormatter::BF_INTEGER);
-    os.myStream.read((char*) &i, sizeof(int));
+    os.readBytes((char*) &i, sizeof(int));
     return os;
 }
 
@@ -118,10 +162,10 @@ operator>>(BinaryInputDevice& os, double& f) {
     int t = os.checkType(BinaryFormatter::BF_FLOAT);
     if (t == BinaryFormatter::BF_SCALED2INT) {
         int v;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes((char*) &v, sizeof(int));
         f = v / 100.;
     } else {
-        os.myStream.read((char*) &f, sizeof(double));
+        os.readBytes((char*) &f, sizeof(double));
     }
     return os;
 }
@@ -131,7 +175,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, bool& b) {
     os.checkType(BinaryFormatter::BF_BYTE);
     b = false;
-    os.myStream.read((char*) &b, sizeof(char));
+    os.readBytes((char*) &b, sizeof(char));
     return os;
 }
 
@@ -140,11 +184,11 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::string& s) {
     os.checkType(BinaryFormatter::BF_STRING);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes((char*) &size, sizeof(int));
     int done = 0;
     while (done < size) {
         const int toRead = MIN2((int)size - done, (int)BUF_MAX - 1);
-        os.myStream.read((char*) &os.myBuffer, sizeof(char)*toRead);
+        os.readBytes((char*) &os.myBuffer, sizeof(char)*toRead);
         os.myBuffer[toRead] = 0;
         s += std::string(os.myBuffer);
         done += toRead;
@@ -157,7 +201,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector<std::string>& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes((char*) &size, sizeof(int));
     while (size > 0) {
         std::string s;
         os >> s;
@@ -172,7 +216,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector<int>& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes((char*) &size, sizeof(int));
     while (size > 0) {
         int i;
         os >> i;
@@ -187,7 +231,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector< std::vector<int> >& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes((char*) &size, sizeof(int));
     while (size > 0) {
         std::vector<int> nested;
         os >> nested;
@@ -204,19 +248,19 @@ operator>>(BinaryInputDevice& os, Position& p) {
     double x, y, z = 0;
     if (t == BinaryFormatter::BF_SCALED2INT_POSITION_2D || t == BinaryFormatter::BF_SCALED2INT_POSITION_2D) {
         int v;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes((char*) &v, sizeof(int));
         x = v / 100.;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes((char*) &v, sizeof(int));
         y = v / 100.;
         if (t == BinaryFormatter::BF_SCALED2INT_POSITION_3D) {
-            os.myStream.read((char*) &v, sizeof(int));
+            os.readBytes((char*) &v, sizeof(int));
             z = v / 100.;
         }
     } else {
-        os.myStream.read((char*) &x, sizeof(double));
-        os.myStream.read((char*) &y, sizeof(double));
+        os.readBytes((char*) &x, sizeof(double));
+        os.readBytes((char*) &y, sizeof(double));
         if (t == BinaryFormatter::BF_POSITION_3D) {
-            os.myStream.read((char*) &z, sizeof(double));
+            os.readBytes((char*) &z, sizeof(double));
         }
     }
     p.set(x, y, z);
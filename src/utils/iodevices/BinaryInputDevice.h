@@ -49,7 +49,8 @@ class BinaryInputDevice;
  * @brief Encapsulates binary reading operations on a file
  *
  * This class opens a binary file stream for reading and offers read access
- *  functions on it.
+ *  functions on it. The file is read in large chunks into an internal buffer
+ *  which is then decoded without further stream operations.
  *
  * Please note that the byte order is undefined. Also the length of each
  *  type is not defined on a global scale and may differ across compilers or
@@ -64,8 +65,12 @@ public:
     /** @brief Constructor
      *
      * @param[in] name The name of the file to open for reading
+     * @param[in] isTyped Whether each value is preceded by its type
+     * @param[in] doValidate Whether the types shall be checked
+     * @param[in] chunkSize The number of bytes read from the file at once (at least 2)
      */
-    BinaryInputDevice(const std::string& name, const bool isTyped = false, const bool doValidate = false);
+    BinaryInputDevice(const std::string& name, const bool isTyped = false, const bool doValidate = false,
+                      const int chunkSize = 1048576);
 
 
     /// @brief Destructor
@@ -217,6 +222,17 @@ public:
 private:
     int checkType(BinaryFormatter::DataType t);
 
+    /** @brief Copies the given number of bytes from the chunk buffer, refilling it if needed
+     *
+     * @param[in] into The memory to copy to
+     * @param[in] numBytes The number of bytes to read
+     * @exception ProcessError If the file ends prematurely
+     */
+    void readBytes(char* into, int numBytes);
+
+    /// @brief Reads the next chunk from the stream keeping the unread part (and one byte for a putback)
+    void fillBuffer();
+
 private:
     /// @brief The encapsulated stream
     std::ifstream myStream;
@@ -226,6 +242,15 @@ private:
     /// @brief Information whether types shall be checked
     const bool myEnableValidation;
 
+    /// @brief The chunk of the file which is currently decoded
+    std::vector<char> myChunk;
+
+    /// @brief The position of the next byte to read in the chunk
+    int myChunkPos;
+
+    /// @brief The number of valid bytes in the chunk
+    int myChunkEnd;
+
     /// @brief The buffer used for string parsing
     char myBuffer[10000];
 
@@ -0,0 +1,312 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    CachingRouter.h
+/// @date    October 2026
+/// @version $Id$
+///
+// Wraps a router and answers repeated queries from a bounded route cache
+/****************************************************************************/
+#ifndef CachingRouter_h
+#define CachingRouter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <list>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <utils/common/MsgHandler.h>
+#include <utils/common/ToString.h>
+#include <utils/common/SUMOVehicleClass.h>
+#include <utils/vehicle/SUMOAbstractRouter.h>
+
+#ifdef HAVE_FOX
+#include <fx.h>
+#endif
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class CachingRouter
+ * @brief Answers routing queries from a route cache, delegating misses to another router
+ *
+ * The cache is keyed by origin, destination, vehicle class, maximum speed and
+ *  speed factor and ignores the departure time, so it should only be used with
+ *  time independent edge efforts. It holds at most a fixed number of routes
+ *  and evicts the least recently used one if needed.
+ *
+ * All entries carry the weight version they were computed for. Calling
+ *  Cache::invalidate() increases the version and thereby makes all cached routes stale
+ *  without touching them. Stale entries are dropped when encountered.
+ *
+ * Every edge of a cached route is indexed, so a query from an edge the route passes
+ *  is answered with the suffix of the route, since every suffix of a shortest path is a
+ *  shortest path itself.
+ *
+ * The cache may be shared by the routers of several threads and is locked internally.
+ *
+ * The template parameters are:
+ * @param E The edge class to use (MSEdge/ROEdge)
+ * @param V The vehicle class to use (MSVehicle/ROVehicle)
+ */
+template<class E, class V>
+class CachingRouter : public SUMOAbstractRouter<E, V> {
+public:
+    /**
+     * @class Cache
+     * @brief A bounded, hashed LRU container of routes
+     */
+    class Cache {
+    public:
+        /// @brief Constructor
+        Cache(const int maxSize) : myMaxSize(maxSize), myVersion(0), myHits(0), mySuffixHits(0), myMisses(0) {}
+
+        /// @brief Destructor
+        ~Cache() {
+            if (myHits + mySuffixHits + myMisses > 0) {
+                WRITE_MESSAGE("Route cache answered " + toString(myHits) + " queries directly and " + toString(mySuffixHits) +
+                              " using route suffixes, " + toString(myMisses) + " queries were computed.");
+            }
+        }
+
+        /// @brief Makes all cached routes stale (to be called whenever the edge weights change)
+        void invalidate() {
+            lock();
+            myVersion++;
+            unlock();
+        }
+
+        /** @brief Retrieves a valid route for the given query
+         *
+         * @param[in] from The origin edge
+         * @param[in] to The destination edge
+         * @param[in] vehicle The vehicle to route
+         * @param[filled] into The container to append the route to
+         * @return whether a route was found
+         */
+        bool get(const E* from, const E* to, const V* const vehicle, std::vector<const E*>& into) {
+            const Key key(from, to, vehicle);
+            lock();
+            typename Index::iterator it = myIndex.find(key);
+            if (it != myIndex.end()) {
+                const EntryIt entry = it->second.first;
+                if (entry->version == myVersion) {
+                    // the route starts at the origin or passes it, its suffix is a shortest path as well
+                    const int offset = it->second.second;
+                    myEntries.splice(myEntries.begin(), myEntries, entry);
+                    into.insert(into.end(), entry->edges.begin() + offset, entry->edges.end());
+                    if (offset == 0) {
+                        myHits++;
+                    } else {
+                        mySuffixHits++;
+                    }
+                    unlock();
+                    return true;
+                }
+                erase(entry);
+            }
+            myMisses++;
+            unlock();
+            return false;
+        }
+
+        /** @brief Stores a computed route, evicting the least recently used one if the cache is full
+         *
+         * Every edge of the route is indexed, so later queries from any of them to
+         *  the same destination are answered by the respective suffix.
+         *
+         * @param[in] from The origin edge
+         * @param[in] to The destination edge
+         * @param[in] vehicle The vehicle the route was computed for
+         * @param[in] edges The route
+         */
+        void put(const E* from, const E* to, const V* const vehicle, const std::vector<const E*>& edges) {
+            if (myMaxSize <= 0 || edges.empty()) {
+                return;
+            }
+            const Key key(from, to, vehicle);
+            lock();
+            while ((int)myEntries.size() >= myMaxSize) {
+                erase(--myEntries.end());
+            }
+            myEntries.push_front(Entry(key, edges, myVersion));
+            for (int i = 0; i < (int)edges.size(); i++) {
+                // the newer route replaces older ones passing the same edge
+                myIndex[Key(edges[i], key)] = std::make_pair(myEntries.begin(), i);
+            }
+            unlock();
+        }
+
+        /// @brief Returns the number of cached routes
+        int size() {
+            lock();
+            const int result = (int)myEntries.size();
+            unlock();
+            return result;
+        }
+
+    private:
+        /// @brief origin, destination, vehicle class, maximum speed and speed factor
+        struct Key {
+            Key(const E* f, const E* t, const V* const v) :
+                from(f), to(t), svc(v->getVClass()), speed(v->getMaxSpeed()), speedFactor(v->getChosenSpeedFactor()) {}
+            /// @brief the key for the same query from another origin
+            Key(const E* f, const Key& k) : from(f), to(k.to), svc(k.svc), speed(k.speed), speedFactor(k.speedFactor) {}
+            bool operator==(const Key& other) const {
+                return from == other.from && to == other.to && svc == other.svc && speed == other.speed && speedFactor == other.speedFactor;
+            }
+            const E* from;
+            const E* to;
+            SUMOVehicleClass svc;
+            double speed;
+            double speedFactor;
+        };
+
+        struct KeyHash {
+            size_t operator()(const Key& k) const {
+                size_t result = std::hash<const E*>()(k.from);
+                result = result * 31 + std::hash<const E*>()(k.to);
+                result = result * 31 + std::hash<int>()((int)k.svc);
+                result = result * 31 + std::hash<double>()(k.speed);
+                return result * 31 + std::hash<double>()(k.speedFactor);
+            }
+        };
+
+        struct Entry {
+            Entry(const Key& k, const std::vector<const E*>& e, const long long int v) : key(k), edges(e), version(v) {}
+            Key key;
+            std::vector<const E*> edges;
+            long long int version;
+        };
+
+        typedef typename std::list<Entry>::iterator EntryIt;
+        /// @brief the lookup from the query to a cached route and the position of the origin in it
+        typedef std::unordered_map<Key, std::pair<EntryIt, int>, KeyHash> Index;
+
+        /// @brief removes the entry and the index positions still referring to it
+        void erase(EntryIt entry) {
+            for (const E* const edge : entry->edges) {
+                typename Index::iterator it = myIndex.find(Key(edge, entry->key));
+                if (it != myIndex.end() && it->second.first == entry) {
+                    myIndex.erase(it);
+                }
+            }
+            myEntries.erase(entry);
+        }
+
+        void lock() {
+#ifdef HAVE_FOX
+            myLock.lock();
+#endif
+        }
+
+        void unlock() {
+#ifdef HAVE_FOX
+            myLock.unlock();
+#endif
+        }
+
+    private:
+        /// @brief the maximum number of routes to keep
+        const int myMaxSize;
+
+        /// @brief the current edge weight version
+        long long int myVersion;
+
+        /// @brief the cached routes, most recently used first
+        std::list<Entry> myEntries;
+
+        /// @brief the lookup from the query to the cached route
+        Index myIndex;
+
+        /// @brief counters for performance logging
+        long long int myHits;
+        long long int mySuffixHits;
+        long long int myMisses;
+
+#ifdef HAVE_FOX
+        /// @brief the lock for access from multiple routing threads
+        FXMutex myLock;
+#endif
+
+    private:
+        /// @brief Invalidated copy constructor
+        Cache(const Cache& s);
+
+        /// @brief Invalidated assignment operator
+        Cache& operator=(const Cache& s);
+    };
+
+
+public:
+    /** @brief Constructor
+     *
+     * @param[in] router The router to delegate cache misses to (is deleted by this router)
+     * @param[in] cache The (possibly shared) cache to use
+     */
+    CachingRouter(SUMOAbstractRouter<E, V>* router, Cache& cache) :
+        SUMOAbstractRouter<E, V>(nullptr, "CachingRouter"), myRouter(router), myCache(cache) {}
+
+    /// @brief Destructor
+    virtual ~CachingRouter() {
+        delete myRouter;
+    }
+
+    virtual SUMOAbstractRouter<E, V>* clone() {
+        return new CachingRouter<E, V>(myRouter->clone(), myCache);
+    }
+
+    /** @brief Builds the route between the given edges, using the cache if possible
+     *
+     * The route is appended to into, only the newly appended part is cached.
+     */
+    bool compute(const E* from, const E* to, const V* const vehicle,
+                 SUMOTime msTime, std::vector<const E*>& into) {
+        if (myCache.get(from, to, vehicle, into)) {
+            return true;
+        }
+        const int numPrior = (int)into.size();
+        const bool result = myRouter->compute(from, to, vehicle, msTime, into);
+        if (result) {
+            myCache.put(from, to, vehicle, std::vector<const E*>(into.begin() + numPrior, into.end()));
+        }
+        return result;
+    }
+
+    double recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
+        return myRouter->recomputeCosts(edges, v, msTime);
+    }
+
+private:
+    /// @brief the router to use for cache misses
+    SUMOAbstractRouter<E, V>* const myRouter;
+
+    /// @brief the route cache
+    Cache& myCache;
+
+private:
+    /// @brief Invalidated assignment operator
+    CachingRouter& operator=(const CachingRouter& s);
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -224,5 +224,9 @@ void
 GenericSAXHandler::myEndElement(int) {}
 
 
+void
+GenericSAXHandler::myCheckBinaryEdges(const std::vector<std::string>&, const std::vector<std::vector<int> >&) {}
+
+
 /****************************************************************************/
 
@@ -208,6 +208,12 @@ public:
     // Reader needs access to myStartElement, myEndElement
     friend class SUMOSAXReader;
 
+    // Prefetcher replays the recorded events
+    friend class SUMOSAXPrefetcher;
+
+    // Binary writer passes the events on after copying them
+    friend class SUMOSAXBinaryWriter;
+
 
 protected:
     /**
@@ -255,6 +261,18 @@ protected:
     virtual void myEndElement(int element);
 
 
+    /** @brief Callback method for the edges stored in the header of a binary file
+     *
+     * Handlers decoding the edge lists of binary routes override this to check that
+     *  the file was written for the loaded network.
+     * @param[in] edgeIDs The ids of the edges by their numerical id in the file
+     * @param[in] successors The numerical ids of the successors of each edge in the file
+     * @exceptions ProcessError These method may throw a ProcessError if the edges do not match
+     */
+    virtual void myCheckBinaryEdges(const std::vector<std::string>& edgeIDs,
+                                    const std::vector<std::vector<int> >& successors);
+
+
 private:
     /**
      * @brief converts from c++-string into unicode
@@ -28,22 +28,36 @@
 #include <utils/xml/SUMORouteHandler.h>
 #include <utils/xml/SUMOSAXReader.h>
 #include <utils/xml/XMLSubSys.h>
+#include <utils/xml/SUMOSAXPrefetcher.h>
 #include "SUMORouteLoader.h"
 
 
 // ===========================================================================
 // method definitions
 // ===========================================================================
-SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler)
-    : myParser(0), myMoreAvailable(true), myHandler(handler) {
+SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler, const bool threaded)
+    : myParser(0), myPrefetcher(0), myMoreAvailable(true), myHandler(handler) {
+    const std::string& file = myHandler->getFileName();
+#ifdef HAVE_FOX
+    // binary files are fast to read anyway and cannot be buffered
+    if (threaded && (file.length() < 4 || file.substr(file.length() - 4) != ".sbx")) {
+        myPrefetcher = new SUMOSAXPrefetcher(*myHandler, file);
+        return;
+    }
+#else
+    UNUSED_PARAMETER(threaded);
+#endif
     myParser = XMLSubSys::getSAXReader(*myHandler);
-    if (!myParser->parseFirst(myHandler->getFileName())) {
-        throw ProcessError("Can not read XML-file '" + myHandler->getFileName() + "'.");
+    if (!myParser->parseFirst(file)) {
+        throw ProcessError("Can not read XML-file '" + file + "'.");
     }
 }
 
 
 SUMORouteLoader::~SUMORouteLoader() {
+#ifdef HAVE_FOX
+    delete myPrefetcher;
+#endif
     delete myParser;
     delete myHandler;
 }
@@ -60,7 +74,12 @@ SUMORouteLoader::loadUntil(SUMOTime time) {
     // read vehicles until specified time or the period to read vehicles
     //  until is reached
     while (myHandler->getLastDepart() <= time) {
-        if (!myParser->parseNext()) {
+#ifdef HAVE_FOX
+        const bool more = myPrefetcher != 0 ? myPrefetcher->replayNext() : myParser->parseNext();
+#else
+        const bool more = myParser->parseNext();
+#endif
+        if (!more) {
             // no data available anymore
             myMoreAvailable = false;
             return SUMOTime_MAX;
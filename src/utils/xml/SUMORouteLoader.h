@@ -36,6 +36,7 @@
 // ===========================================================================
 class SUMORouteHandler;
 class SUMOSAXReader;
+class SUMOSAXPrefetcher;
 
 
 // ===========================================================================
@@ -46,8 +47,12 @@ class SUMOSAXReader;
  */
 class SUMORouteLoader {
 public:
-    /// constructor
-    SUMORouteLoader(SUMORouteHandler* handler);
+    /** @brief constructor
+     *
+     * @param[in] handler The handler to use (is deleted by this loader)
+     * @param[in] threaded Whether the file shall be parsed ahead in a separate thread
+     */
+    SUMORouteLoader(SUMORouteHandler* handler, const bool threaded = false);
 
     /// destructor
     ~SUMORouteLoader();
@@ -66,6 +71,9 @@ private:
     /// the used SAXReader
     SUMOSAXReader* myParser;
 
+    /// the thread parsing ahead (if threaded loading is used)
+    SUMOSAXPrefetcher* myPrefetcher;
+
     /// information whether more vehicles should be available
     bool myMoreAvailable;
 
@@ -31,7 +31,9 @@
 #include <sstream>
 #include <utils/common/RGBColor.h>
 #include <utils/common/TplConvert.h>
+#include <utils/common/ToString.h>
 #include <utils/geom/Boundary.h>
+#include <utils/geom/GeomConvHelper.h>
 #include <utils/geom/PositionVector.h>
 #include <utils/iodevices/BinaryFormatter.h>
 #include <utils/iodevices/BinaryInputDevice.h>
@@ -45,7 +47,8 @@
 SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
     const std::map<int, std::string>& predefinedTagsMML,
     const std::string& objectType,
-    BinaryInputDevice* in, const char version) : SUMOSAXAttributes(objectType), myAttrIds(predefinedTagsMML) {
+    BinaryInputDevice* in, const char version,
+    const std::vector<int>* const attrMap) : SUMOSAXAttributes(objectType), myAttrIds(predefinedTagsMML) {
     while (in->peek() == BinaryFormatter::BF_XML_ATTRIBUTE) {
         int attr;
         unsigned char attrByte;
@@ -56,6 +59,9 @@ SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
             *in >> attrByte;
             attr += 256 * attrByte;
         }
+        if (attrMap != 0 && attr < (int)attrMap->size()) {
+            attr = (*attrMap)[attr];
+        }
         int type = in->peek();
         switch (type) {
             case BinaryFormatter::BF_BYTE:
@@ -170,7 +176,7 @@ bool
 SUMOSAXAttributesImpl_Binary::getBool(int id) const {
     const std::map<int, char>::const_iterator i = myCharValues.find(id);
     if (i == myCharValues.end()) {
-        throw EmptyData();
+        return TplConvert::_2bool(getString(id).c_str());
     }
     return i->second != 0;
 }
@@ -180,7 +186,7 @@ int
 SUMOSAXAttributesImpl_Binary::getInt(int id) const {
     const std::map<int, int>::const_iterator i = myIntValues.find(id);
     if (i == myIntValues.end()) {
-        throw EmptyData();
+        return TplConvert::_2int(getString(id).c_str());
     }
     return i->second;
 }
@@ -196,7 +202,7 @@ std::string
 SUMOSAXAttributesImpl_Binary::getString(int id) const {
     const std::map<int, std::string>::const_iterator i = myStringValues.find(id);
     if (i == myStringValues.end()) {
-        throw EmptyData();
+        return typedToString(id);
     }
     return i->second;
 }
@@ -207,12 +213,42 @@ SUMOSAXAttributesImpl_Binary::getStringSecure(int id,
         const std::string& str) const {
     const std::map<int, std::string>::const_iterator i = myStringValues.find(id);
     if (i == myStringValues.end()) {
-        return str;
+        return hasAttribute(id) ? typedToString(id) : str;
     }
     return i->second;
 }
 
 
+std::string
+SUMOSAXAttributesImpl_Binary::typedToString(int id) const {
+    const std::map<int, double>::const_iterator f = myFloatValues.find(id);
+    if (f != myFloatValues.end()) {
+        // keep all digits, the value is usually parsed again
+        return toString(f->second, 17);
+    }
+    const std::map<int, int>::const_iterator i = myIntValues.find(id);
+    if (i != myIntValues.end()) {
+        return toString(i->second);
+    }
+    const std::map<int, char>::const_iterator c = myCharValues.find(id);
+    if (c != myCharValues.end()) {
+        // chars are either node types, edge functions or booleans
+        if (id == SUMO_ATTR_TYPE && c->second < (char)SUMOXMLDefinitions::NodeTypes.size()) {
+            return toString((SumoXMLNodeType)c->second);
+        }
+        if (id == SUMO_ATTR_FUNCTION && c->second < (char)SUMOXMLDefinitions::EdgeFunctions.size()) {
+            return toString((SumoXMLEdgeFunc)c->second);
+        }
+        return c->second != 0 ? "true" : "false";
+    }
+    const std::map<int, PositionVector>::const_iterator p = myPositionVectors.find(id);
+    if (p != myPositionVectors.end()) {
+        return toString(p->second, 17);
+    }
+    throw EmptyData();
+}
+
+
 double
 SUMOSAXAttributesImpl_Binary::getFloat(int id) const {
     const std::map<int, double>::const_iterator i = myFloatValues.find(id);
@@ -251,6 +287,12 @@ SUMOSAXAttributesImpl_Binary::getEdgeFunc(bool& ok) const {
             return (SumoXMLEdgeFunc)func;
         }
         ok = false;
+    } else if (myStringValues.count(SUMO_ATTR_FUNCTION) != 0) {
+        const std::string& funcString = myStringValues.find(SUMO_ATTR_FUNCTION)->second;
+        if (SUMOXMLDefinitions::EdgeFunctions.hasString(funcString)) {
+            return SUMOXMLDefinitions::EdgeFunctions.get(funcString);
+        }
+        ok = false;
     }
     return EDGEFUNC_NORMAL;
 }
@@ -265,6 +307,12 @@ SUMOSAXAttributesImpl_Binary::getNodeType(bool& ok) const {
             return (SumoXMLNodeType)type;
         }
         ok = false;
+    } else if (myStringValues.count(SUMO_ATTR_TYPE) != 0) {
+        const std::string& typeString = myStringValues.find(SUMO_ATTR_TYPE)->second;
+        if (SUMOXMLDefinitions::NodeTypes.hasString(typeString)) {
+            return SUMOXMLDefinitions::NodeTypes.get(typeString);
+        }
+        ok = false;
     }
     return NODETYPE_UNKNOWN;
 }
@@ -274,7 +322,7 @@ RGBColor
 SUMOSAXAttributesImpl_Binary::getColor() const {
     const std::map<int, int>::const_iterator i = myIntValues.find(SUMO_ATTR_COLOR);
     if (i == myIntValues.end()) {
-        throw EmptyData();
+        return RGBColor::parseColor(getString(SUMO_ATTR_COLOR));
     }
     const int val = i->second;
     return RGBColor(val & 0xff, (val >> 8) & 0xff, (val >> 16) & 0xff, (val >> 24) & 0xff);
@@ -285,7 +333,16 @@ PositionVector
 SUMOSAXAttributesImpl_Binary::getShape(int attr) const {
     const std::map<int, PositionVector>::const_iterator i = myPositionVectors.find(attr);
     if (i == myPositionVectors.end() || i->second.size() == 0) {
-        throw EmptyData();
+        const std::map<int, std::string>::const_iterator s = myStringValues.find(attr);
+        if (s == myStringValues.end() || s->second == "") {
+            throw EmptyData();
+        }
+        bool ok = true;
+        const PositionVector shape = GeomConvHelper::parseShapeReporting(s->second, getObjectType(), 0, ok, true, false);
+        if (!ok) {
+            throw FormatException("shape format");
+        }
+        return shape;
     }
     return i->second;
 }
@@ -295,7 +352,16 @@ Boundary
 SUMOSAXAttributesImpl_Binary::getBoundary(int attr) const {
     const std::map<int, PositionVector>::const_iterator i = myPositionVectors.find(attr);
     if (i == myPositionVectors.end() || i->second.size() == 0) {
-        throw EmptyData();
+        const std::map<int, std::string>::const_iterator s = myStringValues.find(attr);
+        if (s == myStringValues.end() || s->second == "") {
+            throw EmptyData();
+        }
+        bool ok = true;
+        const Boundary boundary = GeomConvHelper::parseBoundaryReporting(s->second, getObjectType(), 0, ok, false);
+        if (!ok) {
+            throw FormatException("boundary format");
+        }
+        return boundary;
     }
     if (i->second.size() != 2) {
         throw FormatException("boundary format");
@@ -31,6 +31,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 #include "SUMOSAXAttributes.h"
 
 
@@ -56,10 +57,12 @@ public:
      * @param[in] attrs The encapsulated xerces-attributes
      * @param[in] predefinedTags Map of attribute ids to their xerces-representation
      * @param[in] predefinedTagsMML Map of attribute ids to their (readable) string-representation
+     * @param[in] attrMap Mapping of the attribute ids used in the file to the current ones (if they differ)
      */
     SUMOSAXAttributesImpl_Binary(const std::map<int, std::string>& predefinedTagsMML,
                                  const std::string& objectType,
-                                 BinaryInputDevice* in, const char version);
+                                 BinaryInputDevice* in, const char version,
+                                 const std::vector<int>* const attrMap = 0);
 
     /// @brief Destructor
     virtual ~SUMOSAXAttributesImpl_Binary();
@@ -287,6 +290,15 @@ public:
     /// @brief return a new deep-copy attributes object
     SUMOSAXAttributes* clone() const;
 
+private:
+    /** @brief Returns the string representation of a typed attribute value
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @return The formatted attribute's value
+     * @exception EmptyData If the attribute is not known
+     */
+    std::string typedToString(int id) const;
+
 private:
     /// @brief Map of attribute ids to names
     const std::map<int, std::string>& myAttrIds;
@@ -0,0 +1,255 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SUMOSAXBinaryWriter.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// Passes the events of an XML file to a handler and writes a binary copy
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <version.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/SysUtils.h>
+#include <utils/common/ToString.h>
+#include <utils/common/TplConvert.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/geom/GeomConvHelper.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+#include <utils/iodevices/OutputDevice.h>
+#include "SUMOXMLDefinitions.h"
+#include "SUMOSAXBinaryWriter.h"
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+const char* const SUMOSAXBinaryWriter::TRAILER_MAGIC = "SBXCACHE";
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+SUMOSAXBinaryWriter::SUMOSAXBinaryWriter(GenericSAXHandler& handler, const std::string& binaryFile) :
+    SUMOSAXHandler(handler.getFileName()),
+    myHandler(handler),
+    myBinaryFile(binaryFile),
+    // concurrent processes must not write into the same file
+    myTempFile(binaryFile.substr(0, binaryFile.length() - 4) + "." + toString(SysUtils::getProcessID()) + ".tmp.sbx"),
+    myOutput(&OutputDevice::getDevice(myTempFile)) {
+    // store all values as parsed, the reduced default precision applies to scaled ints only
+    myOutput->setPrecision(std::numeric_limits<double>::digits10 + 2);
+}
+
+
+SUMOSAXBinaryWriter::~SUMOSAXBinaryWriter() {
+    if (myOutput != 0) {
+        myOutput->close();
+        std::remove(myTempFile.c_str());
+    }
+}
+
+
+bool
+SUMOSAXBinaryWriter::finish(const std::string& file) {
+    if (myOutput == 0) {
+        return false;
+    }
+    myOutput->close();
+    myOutput = 0;
+    // append the trailer which marks the copy as complete
+    {
+        const SUMOTime originalSize = getFileSize(file);
+        std::ofstream trailer(myTempFile.c_str(), std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        const SUMOTime contentSize = (SUMOTime)trailer.tellp();
+        trailer << TRAILER_MAGIC;
+        FileHelpers::writeTime(trailer, originalSize);
+        FileHelpers::writeTime(trailer, contentSize);
+        if (!trailer.good()) {
+            trailer.close();
+            std::remove(myTempFile.c_str());
+            return false;
+        }
+    }
+    std::remove(myBinaryFile.c_str());
+    if (std::rename(myTempFile.c_str(), myBinaryFile.c_str()) != 0) {
+        std::remove(myTempFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+
+bool
+SUMOSAXBinaryWriter::isUpToDate(const std::string& binaryFile, const std::string& file) {
+    if (!FileHelpers::isUpToDate(binaryFile, file)) {
+        return false;
+    }
+    // check the trailer for incomplete or otherwise damaged copies
+    const int trailerSize = (int)std::strlen(TRAILER_MAGIC) + 2 * (int)sizeof(SUMOTime);
+    std::ifstream strm(binaryFile.c_str(), std::ios::binary);
+    strm.seekg(0, std::ios::end);
+    const SUMOTime contentSize = (SUMOTime)strm.tellg() - trailerSize;
+    if (!strm.good() || contentSize <= 0) {
+        return false;
+    }
+    std::vector<char> trailer(trailerSize);
+    strm.seekg(contentSize);
+    strm.read(trailer.data(), trailerSize);
+    SUMOTime storedOriginalSize;
+    SUMOTime storedSize;
+    std::memcpy(&storedOriginalSize, trailer.data() + trailerSize - 2 * sizeof(SUMOTime), sizeof(SUMOTime));
+    std::memcpy(&storedSize, trailer.data() + trailerSize - sizeof(SUMOTime), sizeof(SUMOTime));
+    if (!strm.good() || std::string(trailer.data(), trailerSize - 2 * sizeof(SUMOTime)) != TRAILER_MAGIC || storedSize != contentSize) {
+        return false;
+    }
+    // catches modifications the file system does not resolve in the modification time
+    if (storedOriginalSize != getFileSize(file)) {
+        return false;
+    }
+    strm.close();
+    try {
+        BinaryInputDevice in(binaryFile, true, true);
+        char sbxVersion;
+        in >> sbxVersion;
+        std::string sumoVersion;
+        in >> sumoVersion;
+        // a copy written by another version may lack attributes or interpret them differently
+        return sbxVersion == 2 && sumoVersion == VERSION_STRING;
+    } catch (ProcessError&) {
+        return false;
+    }
+}
+
+
+SUMOTime
+SUMOSAXBinaryWriter::getFileSize(const std::string& file) {
+    std::ifstream strm(file.c_str(), std::ios::binary);
+    strm.seekg(0, std::ios::end);
+    if (!strm.good()) {
+        return -1;
+    }
+    return (SUMOTime)strm.tellg();
+}
+
+
+void
+SUMOSAXBinaryWriter::startElement(const XMLCh* const uri, const XMLCh* const localname,
+                                  const XMLCh* const qname, const XERCES_CPP_NAMESPACE::Attributes& attrs) {
+    const std::string name = TplConvert::_2str(qname);
+    const bool copy = myOutput != 0 && SUMOXMLDefinitions::Tags.hasString(name);
+    if (myOutput != 0 && myCopiedElements.empty()) {
+        if (copy) {
+            myOutput->writeXMLHeader(name, "");
+        } else {
+            // an unknown root element cannot be represented
+            myOutput->close();
+            myOutput = 0;
+            std::remove(myTempFile.c_str());
+        }
+    } else if (copy) {
+        myOutput->openTag(name);
+    }
+    if (copy) {
+        for (int i = 0; i < (int)attrs.getLength(); ++i) {
+            const std::string attrName = TplConvert::_2str(attrs.getLocalName(i));
+            if (!SUMOXMLDefinitions::Attrs.hasString(attrName)) {
+                continue;
+            }
+            const SumoXMLAttr attr = (SumoXMLAttr)SUMOXMLDefinitions::Attrs.get(attrName);
+            const std::string value = TplConvert::_2str(attrs.getValue(i));
+            bool typed = false;
+            try {
+                switch (attr) {
+                    case SUMO_ATTR_SHAPE: {
+                        const PositionVector shape = GeomConvHelper::parseShapeReporting(value, name, 0, typed, false, false);
+                        if (typed) {
+                            myOutput->writeAttr(attr, shape);
+                        }
+                        break;
+                    }
+                    case SUMO_ATTR_X:
+                    case SUMO_ATTR_Y:
+                    case SUMO_ATTR_Z:
+                    case SUMO_ATTR_LENGTH:
+                    case SUMO_ATTR_SPEED:
+                    case SUMO_ATTR_WIDTH:
+                    case SUMO_ATTR_ENDOFFSET:
+                        myOutput->writeAttr(attr, TplConvert::_2double(value.c_str()));
+                        typed = true;
+                        break;
+                    case SUMO_ATTR_INDEX:
+                    case SUMO_ATTR_PRIORITY:
+                    case SUMO_ATTR_FROM_LANE:
+                    case SUMO_ATTR_TO_LANE:
+                    case SUMO_ATTR_TLLINKINDEX:
+                        myOutput->writeAttr(attr, TplConvert::_2int(value.c_str()));
+                        typed = true;
+                        break;
+                    default:
+                        break;
+                }
+            } catch (NumberFormatException&) {
+            } catch (EmptyData&) {
+            }
+            if (!typed) {
+                myOutput->writeAttr(attr, value);
+            }
+        }
+    }
+    myCopiedElements.push_back(copy);
+    GenericSAXHandler::startElement(uri, localname, qname, attrs);
+}
+
+
+void
+SUMOSAXBinaryWriter::endElement(const XMLCh* const uri, const XMLCh* const localname,
+                                const XMLCh* const qname) {
+    GenericSAXHandler::endElement(uri, localname, qname);
+    if (myCopiedElements.back() && myOutput != 0) {
+        myOutput->closeTag();
+    }
+    myCopiedElements.pop_back();
+}
+
+
+void
+SUMOSAXBinaryWriter::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    myHandler.myStartElement(element, attrs);
+}
+
+
+void
+SUMOSAXBinaryWriter::myCharacters(int element, const std::string& chars) {
+    myHandler.myCharacters(element, chars);
+}
+
+
+void
+SUMOSAXBinaryWriter::myEndElement(int element) {
+    myHandler.myEndElement(element);
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,137 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SUMOSAXBinaryWriter.h
+/// @date    October 2026
+/// @version $Id$
+///
+// Passes the events of an XML file to a handler and writes a binary copy
+/****************************************************************************/
+#ifndef SUMOSAXBinaryWriter_h
+#define SUMOSAXBinaryWriter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include "SUMOSAXHandler.h"
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class OutputDevice;
+class SUMOSAXAttributes;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class SUMOSAXBinaryWriter
+ * @brief Passes the events of an XML file to a handler and writes a binary (sbx) copy
+ *
+ * All elements and attributes known to SUMOXMLDefinitions are copied. Shapes and
+ *  some numerical attributes are stored typed, all others as strings (the binary
+ *  attributes convert between both when retrieved). Loading the copy skips the
+ *  XML tokenizing and most of the number parsing.
+ *
+ * The copy is written into a temporary file (unique for the process) which
+ *  replaces the target only when finish() is called after the whole input was
+ *  processed. A trailer with the size of the copy follows the root element and
+ *  is checked before the copy is used.
+ */
+class SUMOSAXBinaryWriter : public SUMOSAXHandler {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] handler The handler to pass the events to
+     * @param[in] binaryFile The name of the binary copy (should end with ".sbx")
+     * @exception IOError If the temporary file could not be opened
+     */
+    SUMOSAXBinaryWriter(GenericSAXHandler& handler, const std::string& binaryFile);
+
+    /// @brief Destructor, removes the temporary file if the copy was not finished
+    ~SUMOSAXBinaryWriter();
+
+    /** @brief Closes the copy and moves it to its final location
+     *
+     * @param[in] file The name of the original file, its size is stored for isUpToDate
+     * @return Whether the binary copy could be stored
+     */
+    bool finish(const std::string& file);
+
+    /** @brief Checks whether the binary copy is complete, at least as recent as the original, made from an original of the same size and readable by this version
+     *
+     * @param[in] binaryFile The name of the binary copy
+     * @param[in] file The name of the original file
+     * @return Whether the binary copy can be loaded instead of the original
+     */
+    static bool isUpToDate(const std::string& binaryFile, const std::string& file);
+
+    /// @brief copies the element with its attributes before passing it on
+    void startElement(const XMLCh* const uri, const XMLCh* const localname,
+                      const XMLCh* const qname, const XERCES_CPP_NAMESPACE::Attributes& attrs);
+
+    /// @brief closes the copied element after passing it on
+    void endElement(const XMLCh* const uri, const XMLCh* const localname,
+                    const XMLCh* const qname);
+
+protected:
+    /// @name inherited from GenericSAXHandler
+    //@{
+    void myStartElement(int element, const SUMOSAXAttributes& attrs);
+    void myCharacters(int element, const std::string& chars);
+    void myEndElement(int element);
+    //@}
+
+private:
+    /// @brief the start of the trailer marking a complete copy
+    static const char* const TRAILER_MAGIC;
+
+    /// @brief returns the size of the given file (-1 if it cannot be read)
+    static SUMOTime getFileSize(const std::string& file);
+
+    /// @brief the handler to pass the events to
+    GenericSAXHandler& myHandler;
+
+    /// @brief the name of the binary copy
+    const std::string myBinaryFile;
+
+    /// @brief the name of the file written during parsing
+    const std::string myTempFile;
+
+    /// @brief the device for the copy (0 after finishing)
+    OutputDevice* myOutput;
+
+    /// @brief for each open element whether it was copied
+    std::vector<bool> myCopiedElements;
+
+private:
+    /// @brief Invalidated copy constructor.
+    SUMOSAXBinaryWriter(const SUMOSAXBinaryWriter& src);
+
+    /// @brief Invalidated assignment operator.
+    SUMOSAXBinaryWriter& operator=(const SUMOSAXBinaryWriter& src);
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
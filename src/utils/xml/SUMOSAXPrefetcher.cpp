@@ -0,0 +1,210 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SUMOSAXPrefetcher.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// Parses an XML file in a separate thread, buffering the events for a handler
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_FOX
+
+#include <memory>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/MsgHandler.h>
+#include <utils/common/ToString.h>
+#include <utils/common/TplConvert.h>
+#include "SUMOSAXAttributes.h"
+#include "SUMOSAXReader.h"
+#include "XMLSubSys.h"
+#include "SUMOSAXPrefetcher.h"
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+SUMOSAXPrefetcher::SUMOSAXPrefetcher(GenericSAXHandler& handler, const std::string& file, const int maxEvents) :
+    SUMOSAXHandler(file),
+    myHandler(handler),
+    myMaxEvents(maxEvents),
+    myFinished(false),
+    myStopped(false) {
+    start();
+}
+
+
+SUMOSAXPrefetcher::~SUMOSAXPrefetcher() {
+    myMutex.lock();
+    myStopped = true;
+    myCondition.broadcast();
+    myMutex.unlock();
+    join();
+    for (std::deque<Event>::iterator i = myEvents.begin(); i != myEvents.end(); ++i) {
+        delete i->attrs;
+    }
+}
+
+
+bool
+SUMOSAXPrefetcher::replayNext() {
+    if (myFinished) {
+        return false;
+    }
+    myMutex.lock();
+    while (myEvents.empty()) {
+        myCondition.wait(myMutex);
+    }
+    Event e = myEvents.front();
+    myEvents.pop_front();
+    if ((int)myEvents.size() == myMaxEvents - 1) {
+        // the parser may be waiting for space
+        myCondition.broadcast();
+    }
+    myMutex.unlock();
+    switch (e.type) {
+        case EVENT_START: {
+            std::unique_ptr<SUMOSAXAttributes> attrs(e.attrs);
+            myHandler.myStartElement(e.element, *attrs);
+            break;
+        }
+        case EVENT_CHARACTERS:
+            myHandler.myCharacters(e.element, e.text);
+            break;
+        case EVENT_END:
+            myHandler.myEndElement(e.element);
+            break;
+        case EVENT_INCLUDE:
+            XMLSubSys::runParser(myHandler, e.text);
+            break;
+        case EVENT_WARNING:
+            WRITE_WARNING(e.text);
+            break;
+        case EVENT_ERROR:
+            myFinished = true;
+            throw ProcessError(e.text);
+        case EVENT_FINISHED:
+            myFinished = true;
+            return false;
+    }
+    return true;
+}
+
+
+FXint
+SUMOSAXPrefetcher::run() {
+    try {
+        std::unique_ptr<SUMOSAXReader> reader(XMLSubSys::getSAXReader(*this));
+        reader->parse(getFileName());
+        push(Event(EVENT_FINISHED, SUMO_TAG_NOTHING, 0, ""));
+    } catch (ProcessError& e) {
+        if (!isStopped()) {
+            const std::string msg = std::string(e.what()) != std::string("") ? std::string(e.what()) : std::string("Process Error");
+            push(Event(EVENT_ERROR, SUMO_TAG_NOTHING, 0, msg));
+        }
+    } catch (const std::exception& ex) {
+        if (!isStopped()) {
+            push(Event(EVENT_ERROR, SUMO_TAG_NOTHING, 0, "Error occurred: " + std::string(ex.what()) + " while parsing '" + getFileName() + "'"));
+        }
+    } catch (...) {
+        if (!isStopped()) {
+            push(Event(EVENT_ERROR, SUMO_TAG_NOTHING, 0, "Unspecified error occurred while parsing '" + getFileName() + "'"));
+        }
+    }
+    return 0;
+}
+
+
+void
+SUMOSAXPrefetcher::startElement(const XMLCh* const uri, const XMLCh* const localname,
+                                const XMLCh* const qname, const XERCES_CPP_NAMESPACE::Attributes& attrs) {
+    if (TplConvert::_2str(qname) != toString(SUMO_TAG_INCLUDE)) {
+        GenericSAXHandler::startElement(uri, localname, qname, attrs);
+        return;
+    }
+    // parsing the included file is left to the consumer which owns the handler
+    std::string file;
+    for (int i = 0; i < (int)attrs.getLength(); ++i) {
+        if (TplConvert::_2str(attrs.getLocalName(i)) == toString(SUMO_ATTR_HREF)) {
+            file = TplConvert::_2str(attrs.getValue(i));
+        }
+    }
+    if (!FileHelpers::isAbsolute(file)) {
+        file = FileHelpers::getConfigurationRelative(getFileName(), file);
+    }
+    push(Event(EVENT_INCLUDE, SUMO_TAG_INCLUDE, 0, file));
+}
+
+
+void
+SUMOSAXPrefetcher::warning(const XERCES_CPP_NAMESPACE::SAXParseException& exception) {
+    push(Event(EVENT_WARNING, SUMO_TAG_NOTHING, 0, buildErrorMessage(exception)));
+}
+
+
+void
+SUMOSAXPrefetcher::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    push(Event(EVENT_START, element, attrs.clone(), ""));
+}
+
+
+void
+SUMOSAXPrefetcher::myCharacters(int element, const std::string& chars) {
+    push(Event(EVENT_CHARACTERS, element, 0, chars));
+}
+
+
+void
+SUMOSAXPrefetcher::myEndElement(int element) {
+    push(Event(EVENT_END, element, 0, ""));
+}
+
+
+bool
+SUMOSAXPrefetcher::isStopped() {
+    FXMutexLock lock(myMutex);
+    return myStopped;
+}
+
+
+void
+SUMOSAXPrefetcher::push(const Event& e) {
+    myMutex.lock();
+    while (!myStopped && (int)myEvents.size() >= myMaxEvents) {
+        myCondition.wait(myMutex);
+    }
+    if (myStopped) {
+        myMutex.unlock();
+        delete e.attrs;
+        // abort the parser
+        throw ProcessError();
+    }
+    myEvents.push_back(e);
+    if (myEvents.size() == 1) {
+        // the consumer may be waiting for data
+        myCondition.broadcast();
+    }
+    myMutex.unlock();
+}
+
+#endif
+
+
+/****************************************************************************/
+
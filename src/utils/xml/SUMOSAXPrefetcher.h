@@ -0,0 +1,166 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SUMOSAXPrefetcher.h
+/// @date    October 2026
+/// @version $Id$
+///
+// Parses an XML file in a separate thread, buffering the events for a handler
+/****************************************************************************/
+#ifndef SUMOSAXPrefetcher_h
+#define SUMOSAXPrefetcher_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_FOX
+
+#include <string>
+#include <deque>
+#include <fx.h>
+#include "SUMOSAXHandler.h"
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class SUMOSAXAttributes;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class SUMOSAXPrefetcher
+ * @brief Parses an XML file in a separate thread, buffering the events for a handler
+ *
+ * The thread runs the parser ahead of the consumer and stores the elements (with a copy
+ *  of their attributes), character data and end tags in a bounded queue. The consumer calls
+ *  replayNext() which passes the next event to the actual handler. Thus the handler
+ *  (and everything it builds) is only accessed by the consuming thread while the
+ *  tokenizing and attribute conversion of the XML run in parallel.
+ *
+ * Included files and messages of the parser are passed as events as well and
+ *  processed by the consuming thread. Binary (.sbx) files are not supported.
+ */
+class SUMOSAXPrefetcher : public SUMOSAXHandler, public FXThread {
+public:
+    /** @brief Constructor, starts the thread
+     *
+     * @param[in] handler The handler to pass the events to
+     * @param[in] file The file to parse
+     * @param[in] maxEvents The maximum number of buffered events
+     */
+    SUMOSAXPrefetcher(GenericSAXHandler& handler, const std::string& file, const int maxEvents = 10000);
+
+    /// @brief Destructor, stops the thread
+    ~SUMOSAXPrefetcher();
+
+    /** @brief Passes the next parsed event to the handler, waiting for the parser if needed
+     *
+     * @return whether more events may follow (false after the end of the file)
+     * @exception ProcessError If the file could not be parsed
+     */
+    bool replayNext();
+
+    /** @brief Main execution method of the thread, parses the file
+     *
+     * @return always 0
+     */
+    FXint run();
+
+    /// @brief Handles the include element which is passed to the consumer
+    void startElement(const XMLCh* const uri, const XMLCh* const localname,
+                      const XMLCh* const qname, const XERCES_CPP_NAMESPACE::Attributes& attrs);
+
+    /// @brief Records parser warnings for the consumer
+    void warning(const XERCES_CPP_NAMESPACE::SAXParseException& exception);
+
+protected:
+    /// @name inherited from GenericSAXHandler, recording the event
+    //@{
+    void myStartElement(int element, const SUMOSAXAttributes& attrs);
+    void myCharacters(int element, const std::string& chars);
+    void myEndElement(int element);
+    //@}
+
+private:
+    /// @brief The kinds of recorded events
+    enum EventType {
+        EVENT_START,
+        EVENT_CHARACTERS,
+        EVENT_END,
+        EVENT_INCLUDE,
+        EVENT_WARNING,
+        EVENT_ERROR,
+        EVENT_FINISHED
+    };
+
+    /// @brief A recorded event
+    struct Event {
+        Event(const EventType t, const int e, SUMOSAXAttributes* a, const std::string& s) : type(t), element(e), attrs(a), text(s) {}
+        EventType type;
+        /// @brief the element (for start, characters and end)
+        int element;
+        /// @brief the copied attributes of a started element
+        SUMOSAXAttributes* attrs;
+        /// @brief the characters, the included file or the message
+        std::string text;
+    };
+
+    /// @brief adds an event to the queue, waiting while the queue is full
+    void push(const Event& e);
+
+    /// @brief whether the thread shall stop parsing (reading the flag under the mutex)
+    bool isStopped();
+
+private:
+    /// @brief the handler to pass the events to
+    GenericSAXHandler& myHandler;
+
+    /// @brief the maximum number of buffered events
+    const int myMaxEvents;
+
+    /// @brief the buffered events
+    std::deque<Event> myEvents;
+
+    /// @brief whether the end of the file (or an error) was replayed
+    bool myFinished;
+
+    /// @brief whether the thread shall stop parsing
+    bool myStopped;
+
+    /// @brief the mutex for the queue
+    FXMutex myMutex;
+
+    /// @brief the condition for waiting on a non empty queue (consumer) or a non full queue (parser)
+    FXCondition myCondition;
+
+private:
+    /// @brief invalidated copy constructor
+    SUMOSAXPrefetcher(const SUMOSAXPrefetcher& s);
+
+    /// @brief invalidated assignment operator
+    const SUMOSAXPrefetcher& operator=(const SUMOSAXPrefetcher& s);
+
+};
+
+#endif
+
+#endif
+
+/****************************************************************************/
+
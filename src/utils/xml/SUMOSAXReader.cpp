@@ -122,10 +122,17 @@ SUMOSAXReader::parseFirst(std::string systemID) {
         *myBinaryInput >> sumoVer;
         std::vector<std::string> elems;
         *myBinaryInput >> elems;
-        // !!! check elems here
+        // map the ids of files written by other versions to the current ones
+        myTagMap.clear();
+        for (const std::string& tag : elems) {
+            myTagMap.push_back(SUMOXMLDefinitions::Tags.hasString(tag) ? SUMOXMLDefinitions::Tags.get(tag) : (int)SUMO_TAG_NOTHING);
+        }
         elems.clear();
         *myBinaryInput >> elems;
-        // !!! check attrs here
+        myAttrMap.clear();
+        for (const std::string& attr : elems) {
+            myAttrMap.push_back(SUMOXMLDefinitions::Attrs.hasString(attr) ? SUMOXMLDefinitions::Attrs.get(attr) : (int)SUMO_ATTR_NOTHING);
+        }
         elems.clear();
         *myBinaryInput >> elems;
         // !!! check node types here
@@ -134,10 +141,10 @@ SUMOSAXReader::parseFirst(std::string systemID) {
         // !!! check edge types here
         elems.clear();
         *myBinaryInput >> elems;
-        // !!! check edges here
         std::vector< std::vector<int> > followers;
         *myBinaryInput >> followers;
-        // !!! check followers here
+        // the routes refer to the edges by their numerical id and their successors by index
+        myHandler->myCheckBinaryEdges(elems, followers);
         return parseNext();
     } else {
         if (myXMLReader == 0) {
@@ -168,8 +175,11 @@ SUMOSAXReader::parseNext() {
                     *myBinaryInput >> tagByte;
                     tag += 256 * tagByte;
                 }
+                if (tag < (int)myTagMap.size()) {
+                    tag = myTagMap[tag];
+                }
                 myXMLStack.push_back((SumoXMLTag)tag);
-                SUMOSAXAttributesImpl_Binary attrs(myHandler->myPredefinedTagsMML, toString((SumoXMLTag)tag), myBinaryInput, mySbxVersion);
+                SUMOSAXAttributesImpl_Binary attrs(myHandler->myPredefinedTagsMML, toString((SumoXMLTag)tag), myBinaryInput, mySbxVersion, &myAttrMap);
                 myHandler->myStartElement(tag, attrs);
                 break;
             }
@@ -180,6 +190,12 @@ SUMOSAXReader::parseNext() {
                 myHandler->myEndElement(myXMLStack.back());
                 myXMLStack.pop_back();
                 myBinaryInput->read(mySbxVersion > 1 ? 1 : 2);
+                if (myXMLStack.empty()) {
+                    // the root element is closed, ignore anything following (e.g. the trailer of a binary cache)
+                    delete myBinaryInput;
+                    myBinaryInput = 0;
+                    return false;
+                }
                 break;
             }
             default:
@@ -115,6 +115,12 @@ private:
 
     char mySbxVersion;
 
+    /// @brief The mapping of the element ids in the binary file to the current ones
+    std::vector<int> myTagMap;
+
+    /// @brief The mapping of the attribute ids in the binary file to the current ones
+    std::vector<int> myAttrMap;
+
     /// @brief The stack of begun xml elements
     std::vector<SumoXMLTag> myXMLStack;
 
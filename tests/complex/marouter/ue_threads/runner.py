@@ -0,0 +1,49 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import re
+import subprocess
+import sys
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+marouterBinary = sumolib.checkBinary('marouter')
+
+# the network, districts and matrix of the sue tests
+INPUT = os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', 'marouter', 'sue')
+
+
+def runAssignment(threads, output):
+    proc = subprocess.Popen([marouterBinary,
+                             "-n", os.path.join(INPUT, "input_net.net.xml"),
+                             "-d", os.path.join(INPUT, "input_taz.taz.xml"),
+                             "-m", os.path.join(INPUT, "input_od_vm.fma"),
+                             "--assignment-method", "UE", "--routing-threads", str(threads),
+                             "--output", output],
+                            stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    messages = proc.communicate()
+    with open(output) as routes:
+        # skip the header comment which contains the options
+        return messages, re.sub("<!--.*?-->", "", routes.read(), flags=re.DOTALL).splitlines()
+
+
+sequential = runAssignment(0, "routes_0.rou.xml")
+print("threads", 0, "routes written", len([l for l in sequential[1] if "<route " in l]) > 0)
+parallel = runAssignment(2, "routes_2.rou.xml")
+print("threads", 2, "identical messages", parallel[0] == sequential[0])
+print("threads", 2, "identical routes", parallel[1] == sequential[1])
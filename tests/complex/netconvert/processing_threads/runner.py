@@ -0,0 +1,45 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import re
+import subprocess
+import sys
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+netconvertBinary = sumolib.checkBinary('netconvert')
+
+# the input of the osm roundtrip test
+OSM = os.path.join(os.path.dirname(sys.argv[0]), '..', 'osm_roundtrip', 'osm.xml')
+
+
+def buildNetwork(threads, output):
+    proc = subprocess.Popen([netconvertBinary, "--osm-files", OSM, "--sidewalks.guess", "--crossings.guess",
+                             "--processing-threads", str(threads), "-o", output],
+                            stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    messages = proc.communicate()
+    with open(output) as net:
+        # skip the header comment which contains the options
+        return messages, re.sub("<!--.*?-->", "", net.read(), count=1, flags=re.DOTALL)
+
+
+sequential = buildNetwork(1, "net_1.net.xml")
+print("threads", 1, "junctions built", "<junction " in sequential[1])
+parallel = buildNetwork(4, "net_4.net.xml")
+print("threads", 4, "identical messages", parallel[0] == sequential[0])
+print("threads", 4, "identical network", parallel[1] == sequential[1])
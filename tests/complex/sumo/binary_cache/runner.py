@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import glob
+import os
+import subprocess
+import sys
+import time
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+netconvertBinary = sumolib.checkBinary('netconvert')
+sumoBinary = sumolib.checkBinary('sumo')
+
+NET = "circular.net.xml"
+CACHE = "circular.net.sbx"
+
+
+def runSimulation():
+    sys.stdout.flush()
+    subprocess.call([sumoBinary, "-c", "sumo.sumocfg"], stdout=sys.stdout, stderr=sys.stderr)
+    sys.stdout.flush()
+    with open("tripinfos.xml") as tripinfos:
+        return [l for l in tripinfos if "<tripinfo " in l]
+
+
+def report(label, trips, reference):
+    print(label, "cache exists", os.path.exists(CACHE),
+          "temporary files", len(glob.glob("*.tmp.sbx")),
+          "identical output", trips == reference)
+
+
+print(">>> Building the network")
+sys.stdout.flush()
+subprocess.call([netconvertBinary, "-c", "netconvert.netccfg"], stdout=sys.stdout, stderr=sys.stderr)
+sys.stdout.flush()
+
+print(">>> Writing the cache")
+reference = runSimulation()
+report("created", reference, reference)
+written = os.path.getmtime(CACHE)
+
+print(">>> Reusing the cache")
+# make sure a rewrite would be visible in the modification time
+time.sleep(1.1)
+report("reused", runSimulation(), reference)
+print("unchanged", os.path.getmtime(CACHE) == written)
+
+print(">>> Truncated cache")
+size = os.path.getsize(CACHE)
+with open(CACHE, "r+b") as cache:
+    cache.truncate(size - 10)
+report("truncated", runSimulation(), reference)
+print("rewritten", os.path.getsize(CACHE) == size)
+
+print(">>> Modified network")
+written = os.path.getmtime(CACHE)
+time.sleep(1.1)
+os.utime(NET, None)
+report("modified", runSimulation(), reference)
+print("rewritten", os.path.getmtime(CACHE) > written)
+
+print(">>> Network modified right after writing the cache")
+written = os.path.getmtime(CACHE)
+# no waiting, the modification falls into the same second as writing the cache
+with open(NET, "a") as net:
+    net.write("\n")
+report("modified quickly", runSimulation(), reference)
+print("rewritten", os.path.getmtime(CACHE) > written)
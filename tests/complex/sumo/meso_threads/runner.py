@@ -0,0 +1,52 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+netgenerateBinary = sumolib.checkBinary('netgenerate')
+sumoBinary = sumolib.checkBinary('sumo')
+
+NUM_VEHICLES = 4 * 300
+
+subprocess.call([netgenerateBinary, "--grid", "--grid.number", "10", "--grid.length", "200",
+                 "-o", "net.net.xml"], stdout=open(os.devnull, "w"), stderr=sys.stderr)
+
+
+def runSimulation(threads, output):
+    # the tripinfo and emission devices are notified from the region threads
+    subprocess.call([sumoBinary, "-n", "net.net.xml", "-r", "input_routes.rou.xml", "--mesosim",
+                     "--meso-threads", str(threads), "--device.emissions.probability", "1",
+                     "--tripinfo-output", output, "--no-step-log"],
+                    stdout=sys.stdout, stderr=sys.stderr)
+    sys.stdout.flush()
+    with open(output) as tripinfos:
+        return [l for l in tripinfos if "<tripinfo " in l or "<emissions " in l]
+
+
+def report(threads, trips):
+    print("threads", threads, "all vehicles arrived",
+          len([l for l in trips if "<tripinfo " in l]) == NUM_VEHICLES)
+
+
+report(0, runSimulation(0, "tripinfos_0.xml"))
+parallel = runSimulation(4, "tripinfos_4.xml")
+report(4, parallel)
+print("threads", 4, "identical to previous run", runSimulation(4, "tripinfos_4b.xml") == parallel)
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import re
+import subprocess
+import sys
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+netgenerateBinary = sumolib.checkBinary('netgenerate')
+sumoBinary = sumolib.checkBinary('sumo')
+
+NUM_VEHICLES = 1000
+EDGES = [("A0A1", "D2D3"), ("D3D2", "A1A0"), ("A0B0", "C3D3"), ("D3C3", "B0A0")]
+
+subprocess.call([netgenerateBinary, "--grid", "--grid.number", "4", "--grid.length", "100",
+                 "-o", "net.net.xml"], stdout=open(os.devnull, "w"), stderr=sys.stderr)
+
+# many small elements and an included file to keep the parser thread busy
+with open("types.rou.xml", "w") as types:
+    print('<routes>', file=types)
+    print('    <vType id="slow" maxSpeed="10" sigma="0"/>', file=types)
+    print('</routes>', file=types)
+with open("routes.rou.xml", "w") as routes:
+    print('<routes>', file=routes)
+    print('    <include href="types.rou.xml"/>', file=routes)
+    for i in range(NUM_VEHICLES):
+        fromEdge, toEdge = EDGES[i % len(EDGES)]
+        print('    <trip id="%s" type="slow" depart="%s" from="%s" to="%s">' % (i, i, fromEdge, toEdge), file=routes)
+        print('        <param key="index" value="%s"/>' % i, file=routes)
+        print('    </trip>', file=routes)
+    print('</routes>', file=routes)
+
+
+def runSimulation(threaded, suffix):
+    args = [sumoBinary, "-n", "net.net.xml", "-r", "routes.rou.xml", "--route-steps", "50",
+            "--tripinfo-output", "tripinfos_%s.xml" % suffix, "--vehroute-output", "vehroutes_%s.xml" % suffix,
+            "--no-step-log"]
+    if threaded:
+        args.append("--route-loading.threaded")
+    proc = subprocess.Popen(args, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    messages = proc.communicate()
+    result = [messages]
+    for output in ("tripinfos_%s.xml" % suffix, "vehroutes_%s.xml" % suffix):
+        with open(output) as f:
+            # the header comment contains the configuration with the option
+            result.append(re.sub("<!--.*?-->", "", f.read(), flags=re.DOTALL))
+    return result
+
+
+plain = runSimulation(False, "plain")
+print("plain all vehicles arrived", plain[1].count("<tripinfo ") == NUM_VEHICLES)
+threaded = runSimulation(True, "threaded")
+print("threaded identical messages", threaded[0] == plain[0])
+print("threaded identical tripinfos", threaded[1] == plain[1])
+print("threaded identical vehroutes", threaded[2] == plain[2])
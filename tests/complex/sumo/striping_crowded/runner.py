@@ -0,0 +1,63 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+sumoBinary = sumolib.checkBinary('sumo')
+
+NET = os.path.join('..', 'striping_threads', 'input_net.net.xml')
+NUM_PERSONS = 400
+ROUTES = ["AB BC CD DE", "DE CD BC AB"]
+
+# crowds starting at both ends every second, so that many pedestrians share stripes and meet oncoming ones
+with open("crowded.rou.xml", "w") as routes:
+    print('<routes>', file=routes)
+    print('    <vType id="ped" vClass="pedestrian"/>', file=routes)
+    for i in range(NUM_PERSONS):
+        print('    <person id="p%s" type="ped" depart="%s" departPos="0">' % (i, i // 4), file=routes)
+        print('        <walk edges="%s" arrivalPos="-1"/>' % ROUTES[i % 2], file=routes)
+        print('    </person>', file=routes)
+    print('</routes>', file=routes)
+
+
+def runSimulation(name, threads, options=[]):
+    # the lanes are moved in threads in every run, the random numbers depend on it
+    # warnings about collisions and jams are compared via the log instead of the error output
+    subprocess.call([sumoBinary, "-n", NET, "-r", "crowded.rou.xml",
+                     "--pedestrian.model", "striping", "--pedestrian.striping.threads", str(threads),
+                     "--tripinfo-output", "tripinfos_%s.xml" % name,
+                     "--error-log", "warnings_%s.txt" % name, "--no-step-log"] + options,
+                    stdout=sys.stdout, stderr=open(os.devnull, "w"))
+    sys.stdout.flush()
+    with open("tripinfos_%s.xml" % name) as tripinfos:
+        persons = [l for l in tripinfos if "<personinfo " in l or "<walk " in l]
+    with open("warnings_%s.txt" % name) as warnings:
+        return persons, warnings.read()
+
+
+checked = runSimulation("checked", 1)
+print("all persons arrived", len([l for l in checked[0] if "<personinfo " in l]) == NUM_PERSONS)
+# the collision check only writes warnings, it must not change the movement
+ignored = runSimulation("ignored", 1, ["--ignore-accidents"])
+print("ignore accidents identical tripinfos", ignored[0] == checked[0])
+threads = runSimulation("threads", 4)
+print("threads 4 identical tripinfos", threads[0] == checked[0])
+print("threads 4 identical warnings", threads[1] == checked[1])
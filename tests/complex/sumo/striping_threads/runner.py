@@ -0,0 +1,44 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+sumoBinary = sumolib.checkBinary('sumo')
+
+NUM_PERSONS = 300
+
+
+def runSimulation(threads, output):
+    # dawdling draws random numbers which are seeded per lane when running in threads
+    subprocess.call([sumoBinary, "-n", "input_net.net.xml", "-r", "input_routes.rou.xml",
+                     "--pedestrian.model", "striping", "--pedestrian.striping.dawdling", "0.2",
+                     "--pedestrian.striping.threads", str(threads),
+                     "--tripinfo-output", output, "--no-step-log"],
+                    stdout=sys.stdout, stderr=sys.stderr)
+    sys.stdout.flush()
+    with open(output) as tripinfos:
+        return [l for l in tripinfos if "<personinfo " in l or "<walk " in l]
+
+
+one = runSimulation(1, "tripinfos_1.xml")
+print("threads", 1, "all persons arrived", len([l for l in one if "<personinfo " in l]) == NUM_PERSONS)
+four = runSimulation(4, "tripinfos_4.xml")
+print("threads", 4, "identical to threads", 1, four == one)
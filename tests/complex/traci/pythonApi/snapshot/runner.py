@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @date    2026-10-19
+# @version $Id$
+
+
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import sys
+SUMO_HOME = os.path.join(os.path.dirname(__file__), "..", "..", "..", "..", "..")
+sys.path += [os.path.join(SUMO_HOME, "tools"), os.path.join(SUMO_HOME, "bin")]
+if len(sys.argv) > 1:
+    import libsumo as traci  # noqa
+else:
+    import traci  # noqa
+import sumolib  # noqa
+
+
+def run(steps):
+    """simulates the given number of steps and records the vehicle states and detector values"""
+    result = []
+    for step in range(steps):
+        traci.simulationStep()
+        vehicles = sorted((vehID, traci.vehicle.getRoadID(vehID), traci.vehicle.getLanePosition(vehID),
+                           traci.vehicle.getSpeed(vehID)) for vehID in traci.vehicle.getIDList())
+        result.append((traci.simulation.getCurrentTime(), vehicles,
+                       traci.inductionloop.getLastStepVehicleIDs("det")))
+    return result
+
+
+traci.start([sumolib.checkBinary('sumo'), "-c", "sumo.sumocfg"])
+run(20)
+traci.simulation.saveSnapshot("start")
+print("saved at", traci.simulation.getCurrentTime())
+first = run(100)
+traci.simulation.restoreSnapshot("start")
+print("restored to", traci.simulation.getCurrentTime())
+second = run(100)
+print("vehicles seen", len(set(v[0] for step in first for v in step[1])) > 0)
+print("identical after first restore", first == second)
+# restoring a second time from the same snapshot gives the same result again
+traci.simulation.restoreSnapshot("start")
+third = run(100)
+print("identical after second restore", first == third)
+traci.close()
@@ -0,0 +1,207 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    benchmark.py
+# @date    October 2026
+# @version $Id$
+
+"""
+Measures the throughput of the simulation step loop on a set of canonical
+generated scenarios and appends the results (one JSON object per scenario
+and line) to a results file for trend tracking.
+
+For each scenario the network and the demand are generated into a subdirectory
+of the working directory and sumo is run with --profiling-output. The reported values are
+the vehicle steps per second, the throughput (vehicle and person steps per
+second), the time spent in the phases of the simulation step and the peak
+memory usage. If a baseline results file is given, the script exits with an
+error if the throughput of a scenario dropped by more than the given tolerance
+compared to the last baseline entry.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import json
+import time
+import subprocess
+import optparse
+import xml.etree.ElementTree as ET
+
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+import sumolib  # noqa
+
+RANDOM_TRIPS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'randomTrips.py')
+
+
+def call(args, log):
+    log.write(" ".join(args) + "\n")
+    log.flush()
+    subprocess.check_call(args, stdout=log, stderr=log)
+
+
+def motorway(options, log):
+    """three lane motorway with platoons of vehicles using the CC car following model"""
+    with open("motorway.nod.xml", "w") as nodes:
+        print('<nodes>', file=nodes)
+        for i in range(11):
+            print('    <node id="n%s" x="%s" y="0"/>' % (i, i * 1000), file=nodes)
+        print('</nodes>', file=nodes)
+    with open("motorway.edg.xml", "w") as edges:
+        print('<edges>', file=edges)
+        for i in range(10):
+            print('    <edge id="e%s" from="n%s" to="n%s" numLanes="3" speed="36.11"/>' % (i, i, i + 1), file=edges)
+        print('</edges>', file=edges)
+    call([sumolib.checkBinary('netconvert'), '-n', 'motorway.nod.xml', '-e', 'motorway.edg.xml',
+          '-o', 'motorway.net.xml'], log)
+    with open("motorway.rou.xml", "w") as routes:
+        print('<routes>', file=routes)
+        print('    <vType id="platoon" carFollowModel="CC" length="4" minGap="1" maxSpeed="36"/>', file=routes)
+        print('    <route id="r" edges="%s"/>' % " ".join(["e%s" % i for i in range(10)]), file=routes)
+        for lane in range(3):
+            print(('    <flow id="f%s" type="platoon" route="r" begin="0" end="%s" period="%s" departLane="%s" ' +
+                   'departSpeed="max"/>') % (lane, options.end, 1.5 / options.scale, lane), file=routes)
+        print('</routes>', file=routes)
+    return ['-n', 'motorway.net.xml', '-r', 'motorway.rou.xml']
+
+
+def urban(options, log):
+    """urban grid with traffic lights at all intersections"""
+    call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '10', '--grid.length', '200',
+          '--default.lanenumber', '2', '--tls.guess', '-o', 'urban.net.xml'], log)
+    call([sys.executable, RANDOM_TRIPS, '-n', 'urban.net.xml', '-o', 'urban.trips.xml', '-r', 'urban.rou.xml',
+          '-e', str(options.end), '-p', str(0.5 / options.scale), '--fringe-factor', '10', '-s', '42'], log)
+    return ['-n', 'urban.net.xml', '-r', 'urban.rou.xml']
+
+
+def pedestrians(options, log):
+    """small grid with sidewalks and crossings and many pedestrians (striping model)"""
+    call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '5', '--grid.length', '100',
+          '--sidewalks.guess', '--crossings.guess', '--tls.guess', '-o', 'pedestrians.net.xml'], log)
+    call([sys.executable, RANDOM_TRIPS, '-n', 'pedestrians.net.xml', '-o', 'pedestrians.rou.xml',
+          '--pedestrians', '-e', str(options.end), '-p', str(0.2 / options.scale), '-s', '42'], log)
+    return ['-n', 'pedestrians.net.xml', '-r', 'pedestrians.rou.xml']
+
+
+def meso(options, log):
+    """large grid simulated with the mesoscopic model"""
+    call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '20', '--grid.length', '300',
+          '--default.lanenumber', '2', '--tls.guess', '-o', 'meso.net.xml'], log)
+    call([sys.executable, RANDOM_TRIPS, '-n', 'meso.net.xml', '-o', 'meso.trips.xml', '-r', 'meso.rou.xml',
+          '-e', str(options.end), '-p', str(0.1 / options.scale), '--fringe-factor', '10', '-s', '42'], log)
+    return ['-n', 'meso.net.xml', '-r', 'meso.rou.xml', '--mesosim']
+
+
+SCENARIOS = [("motorway", motorway), ("urban", urban), ("pedestrians", pedestrians), ("meso", meso)]
+
+
+def parseProfile(profileFile):
+    root = ET.parse(profileFile).getroot()
+    sim = root.find("simulation")
+    result = {
+        "steps": int(sim.get("steps")),
+        "vehicleSteps": int(sim.get("vehicleSteps")),
+        "duration": float(sim.get("duration")),
+        "vehicleStepsPerSecond": float(sim.get("vehicleStepsPerSecond")),
+        "personSteps": int(sim.get("personSteps")),
+        "peakMemory": int(sim.get("peakMemory")),
+        "phases": {},
+    }
+    for phase in root.findall("phase"):
+        result["phases"][phase.get("name")] = float(phase.get("duration"))
+    duration = result["duration"] / 1000.
+    result["throughput"] = (result["vehicleSteps"] + result["personSteps"]) / duration if duration > 0 else 0.
+    return result
+
+
+def runScenario(name, build, options, log):
+    scenarioDir = os.path.join(options.workdir, name)
+    if not os.path.isdir(scenarioDir):
+        os.makedirs(scenarioDir)
+    oldDir = os.getcwd()
+    os.chdir(scenarioDir)
+    try:
+        args = build(options, log)
+        best = None
+        for _ in range(options.repeat):
+            call([sumolib.checkBinary('sumo'), '--no-step-log', '--end', str(options.end),
+                  '--profiling-output', 'profile.xml'] + args, log)
+            result = parseProfile('profile.xml')
+            if best is None or result["throughput"] > best["throughput"]:
+                best = result
+        return best
+    finally:
+        os.chdir(oldDir)
+
+
+def readBaseline(baselineFile):
+    baseline = {}
+    if baselineFile and os.path.exists(baselineFile):
+        with open(baselineFile) as f:
+            for line in f:
+                if line.strip():
+                    entry = json.loads(line)
+                    # the last entry of each scenario wins
+                    baseline[entry["scenario"]] = entry
+    return baseline
+
+
+def getOptions(args=None):
+    optParser = optparse.OptionParser(usage="%prog [options]")
+    optParser.add_option("-s", "--scenarios", default=",".join([s[0] for s in SCENARIOS]),
+                         help="comma separated list of scenarios to run")
+    optParser.add_option("-d", "--workdir", default="benchmark", help="directory for the generated scenarios")
+    optParser.add_option("-o", "--output", default="benchmark.json",
+                         help="file to append the results to (one JSON object per line)")
+    optParser.add_option("-b", "--baseline", help="results file to compare the throughput against")
+    optParser.add_option("-t", "--tolerance", type="float", default=0.1,
+                         help="maximum relative throughput loss compared to the baseline")
+    optParser.add_option("-e", "--end", type="int", default=1800, help="simulation end time")
+    optParser.add_option("--scale", type="float", default=1., help="scale the demand of all scenarios")
+    optParser.add_option("-r", "--repeat", type="int", default=1,
+                         help="number of runs per scenario, the fastest one is reported")
+    optParser.add_option("-l", "--log", default="benchmark.log", help="file for the output of the called tools")
+    optParser.add_option("--revision", default="", help="revision identifier to store with the results")
+    options, _ = optParser.parse_args(args=args)
+    options.workdir = os.path.abspath(options.workdir)
+    return options
+
+
+def main(options):
+    known = dict(SCENARIOS)
+    baseline = readBaseline(options.baseline)
+    regressions = []
+    with open(options.log, "w") as log, open(options.output, "a") as out:
+        for name in options.scenarios.split(","):
+            if name not in known:
+                print("Unknown scenario '%s'." % name, file=sys.stderr)
+                return 2
+            result = runScenario(name, known[name], options, log)
+            result["scenario"] = name
+            result["revision"] = options.revision
+            result["date"] = time.strftime("%Y-%m-%dT%H:%M:%S")
+            result["scale"] = options.scale
+            out.write(json.dumps(result, sort_keys=True) + "\n")
+            out.flush()
+            print("%s: %.0f vehicle and person steps/s, %.1f ms/step, peak memory %.1f MB" % (
+                name, result["throughput"], result["duration"] / max(1, result["steps"]),
+                result["peakMemory"] / 1e6))
+            if name in baseline:
+                reference = baseline[name]["throughput"]
+                if reference > 0 and result["throughput"] < reference * (1 - options.tolerance):
+                    regressions.append("%s: %.0f steps/s (baseline %.0f)" % (name, result["throughput"], reference))
+    if regressions:
+        print("Throughput regressions:\n  " + "\n  ".join(regressions), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(getOptions()))
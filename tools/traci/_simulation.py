@@ -393,6 +393,26 @@ class SimulationDomain(Domain):
         self._connection._packString(fileName)
         self._connection._sendExact()
 
+    def saveSnapshot(self, snapshotID):
+        """saveSnapshot(string) -> None
+
+        Keeps the current simulation state in memory under the given id.
+        """
+        self._connection._beginMessage(tc.CMD_SET_SIM_VARIABLE, tc.CMD_SAVE_SNAPSHOT, "",
+                                       1 + 4 + len(snapshotID))
+        self._connection._packString(snapshotID)
+        self._connection._sendExact()
+
+    def restoreSnapshot(self, snapshotID):
+        """restoreSnapshot(string) -> None
+
+        Resets the simulation to the state saved under the given id.
+        """
+        self._connection._beginMessage(tc.CMD_SET_SIM_VARIABLE, tc.CMD_RESTORE_SNAPSHOT, "",
+                                       1 + 4 + len(snapshotID))
+        self._connection._packString(snapshotID)
+        self._connection._sendExact()
+
     def subscribe(self, varIDs=(tc.VAR_DEPARTED_VEHICLES_IDS,), begin=0, end=2**31 - 1):
         """subscribe(list(integer), double, double) -> None
 
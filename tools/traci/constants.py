@@ -832,6 +832,12 @@ CMD_CLEAR_PENDING_VEHICLES = 0x94
 #  triggers saving simulation state (set: simulation)
 CMD_SAVE_SIMSTATE = 0x95
 
+#  keeps the simulation state in memory (set: simulation)
+CMD_SAVE_SNAPSHOT = 0x96
+
+#  resets the simulation to a state kept in memory (set: simulation)
+CMD_RESTORE_SNAPSHOT = 0x97
+
 #  sets/retrieves abstract parameter
 VAR_PARAMETER = 0x7e
 
@@ -35,3 +35,22 @@ TEST(MSEventControl, test_method_execute) {
     eventControl.execute(5);
     EXPECT_TRUE(mock->isExecuteCalled());
 }
+
+/* Test the methods 'getEvents' and 'restoreEvents'. Tests if saved events get their execution time back.*/
+
+TEST(MSEventControl, test_method_restoreEvents) {
+
+    MSEventControl eventControl;
+    eventControl.addEvent(new CommandMock(), 0);
+    eventControl.addEvent(new CommandMock(), 2000);
+    const std::vector<MSEventControl::PendingEvent> saved = eventControl.getEvents();
+
+    // the first event is not repeated, the second one is moved to 3500
+    eventControl.execute(0);
+    eventControl.execute(1500);
+    EXPECT_EQ(3500, eventControl.getEvents().front().time);
+
+    EXPECT_EQ(1, eventControl.restoreEvents(saved));
+    ASSERT_EQ(1, (int)eventControl.getEvents().size());
+    EXPECT_EQ(2000, eventControl.getEvents().front().time);
+}
@@ -0,0 +1,79 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    CalendarQueueTest.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// Tests CalendarQueue class from <SUMO>/src/utils/common
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <gtest/gtest.h>
+#include <utils/common/CalendarQueue.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests the order of values within and beyond the bucket ring. */
+TEST(CalendarQueue, test_order) {
+    CalendarQueue<int> q(1000, 4);
+    q.push(2500, 3);
+    q.push(100000, 6);
+    q.push(0, 1);
+    q.push(7000, 5);
+    q.push(2100, 2);
+    q.push(2500, 4);
+    EXPECT_EQ(6, q.size());
+    for (int i = 1; i <= 6; i++) {
+        EXPECT_FALSE(q.empty());
+        EXPECT_EQ(i, q.pop());
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+/* Tests adding values for the current and past times while popping. */
+TEST(CalendarQueue, test_push_while_popping) {
+    CalendarQueue<int> q(1000, 4);
+    q.push(5000, 1);
+    q.push(5500, 3);
+    EXPECT_EQ(5000, q.topTime());
+    EXPECT_EQ(1, q.pop());
+    q.push(5200, 2);
+    q.push(-1, 0);
+    EXPECT_EQ(-1, q.topTime());
+    EXPECT_EQ(0, q.pop());
+    EXPECT_EQ(2, q.pop());
+    EXPECT_EQ(3, q.pop());
+    EXPECT_TRUE(q.empty());
+}
+
+/* Tests removing values. */
+TEST(CalendarQueue, test_remove) {
+    CalendarQueue<int> q(1000, 4);
+    q.push(1000, 1);
+    q.push(1000, 2);
+    q.push(50000, 3);
+    EXPECT_TRUE(q.remove(1000, 1));
+    EXPECT_FALSE(q.remove(1000, 1));
+    EXPECT_TRUE(q.remove(50000, 3));
+    EXPECT_EQ(1, q.size());
+    EXPECT_EQ(2, q.pop());
+    EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,58 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    PollutantsInterfaceTest.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// Tests the batched emission computation of the class PollutantsInterface
+/****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utils/emissions/PollutantsInterface.h>
+
+using namespace std;
+
+/* Test the batched computation against the computation for single pollutants.*/
+TEST(PollutantsInterface, test_method_computeAll_batch) {
+    const string names[] = {"HBEFA3/PC_G_EU4", "HBEFA3/HDV_D_EU5", "HBEFA3/zero", "HBEFA2/P_7_7", "HBEFA2/HDV_A0_3_1", "Energy/unknown"};
+    const double speeds[] = {0., 5., 13.9, 33.};
+    const double accels[] = {-2., 0., 0.5, 2.6};
+    vector<SUMOEmissionClass> classes;
+    vector<double> v, a, slope;
+    for (const string& name : names) {
+        for (double speed : speeds) {
+            for (double accel : accels) {
+                classes.push_back(PollutantsInterface::getClassByName(name));
+                v.push_back(speed);
+                a.push_back(accel);
+                slope.push_back(accel > 0 ? 1.5 : 0.);
+            }
+        }
+    }
+    vector<PollutantsInterface::Emissions> result;
+    PollutantsInterface::computeAll(classes, v, a, slope, result);
+    ASSERT_EQ(classes.size(), result.size());
+    for (int i = 0; i < (int)classes.size(); i++) {
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::CO2, v[i], a[i], slope[i]), result[i].CO2);
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::CO, v[i], a[i], slope[i]), result[i].CO);
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::HC, v[i], a[i], slope[i]), result[i].HC);
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::FUEL, v[i], a[i], slope[i]), result[i].fuel);
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::NO_X, v[i], a[i], slope[i]), result[i].NOx);
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::PM_X, v[i], a[i], slope[i]), result[i].PMx);
+        EXPECT_DOUBLE_EQ(PollutantsInterface::compute(classes[i], PollutantsInterface::ELEC, v[i], a[i], slope[i]), result[i].electricity);
+    }
+}
+
+/* Test the batched computation with an empty batch.*/
+TEST(PollutantsInterface, test_method_computeAll_empty) {
+    vector<PollutantsInterface::Emissions> result(3);
+    PollutantsInterface::computeAll(vector<SUMOEmissionClass>(), vector<double>(), vector<double>(), vector<double>(), result);
+    EXPECT_TRUE(result.empty());
+}
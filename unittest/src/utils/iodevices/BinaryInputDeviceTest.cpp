@@ -0,0 +1,134 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    BinaryInputDeviceTest.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// Tests BinaryInputDevice class from <SUMO>/src/utils/iodevices
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/iodevices/BinaryFormatter.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+class BinaryInputDeviceTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        std::ofstream out(FILE_NAME, std::ios::binary);
+        FileHelpers::writeByte(out, BinaryFormatter::BF_BYTE);
+        FileHelpers::writeByte(out, 200);
+        FileHelpers::writeByte(out, BinaryFormatter::BF_INTEGER);
+        FileHelpers::writeInt(out, -123456);
+        FileHelpers::writeByte(out, BinaryFormatter::BF_FLOAT);
+        FileHelpers::writeFloat(out, 3.25);
+        FileHelpers::writeByte(out, BinaryFormatter::BF_STRING);
+        FileHelpers::writeString(out, LONG_STRING);
+        FileHelpers::writeByte(out, BinaryFormatter::BF_LIST);
+        FileHelpers::writeInt(out, 3);
+        for (int i = 0; i < 3; i++) {
+            FileHelpers::writeByte(out, BinaryFormatter::BF_INTEGER);
+            FileHelpers::writeInt(out, i * 1000);
+        }
+    }
+
+    virtual void TearDown() {
+        std::remove(FILE_NAME);
+    }
+
+    /// @brief reads the values written in SetUp and checks them
+    void readAll(BinaryInputDevice& in) {
+        unsigned char c;
+        in >> c;
+        EXPECT_EQ(200, c);
+        int i;
+        in >> i;
+        EXPECT_EQ(-123456, i);
+        double d;
+        in >> d;
+        EXPECT_DOUBLE_EQ(3.25, d);
+        std::string s;
+        in >> s;
+        EXPECT_EQ(LONG_STRING, s);
+        std::vector<int> v;
+        in >> v;
+        EXPECT_EQ(std::vector<int>({0, 1000, 2000}), v);
+        EXPECT_EQ(EOF, in.peek());
+    }
+
+    static const char* const FILE_NAME;
+    static const std::string LONG_STRING;
+};
+
+const char* const BinaryInputDeviceTest::FILE_NAME = "binaryInputDeviceTest.bin";
+const std::string BinaryInputDeviceTest::LONG_STRING(100, 'x');
+
+
+/* Tests reading typed values with the default chunk holding the whole file. */
+TEST_F(BinaryInputDeviceTest, test_read_single_chunk) {
+    BinaryInputDevice in(FILE_NAME, true, true);
+    readAll(in);
+}
+
+/* Tests reading typed values which cross the boundaries of small chunks. */
+TEST_F(BinaryInputDeviceTest, test_read_across_chunks) {
+    for (int chunkSize = 2; chunkSize < 20; chunkSize++) {
+        BinaryInputDevice in(FILE_NAME, true, true, chunkSize);
+        readAll(in);
+    }
+}
+
+/* Tests that the raw bytes are the same as read directly from the file. */
+TEST_F(BinaryInputDeviceTest, test_method_read) {
+    std::ifstream direct(FILE_NAME, std::ios::binary);
+    char raw[30];
+    direct.read(raw, 30);
+    BinaryInputDevice in(FILE_NAME, false, false, 7);
+    EXPECT_EQ(std::string(raw, 10), in.read(10));
+    EXPECT_EQ((unsigned char)raw[10], in.peek());
+    EXPECT_EQ(std::string(raw + 10, 20), in.read(20));
+}
+
+/* Tests putting back the last byte read before a chunk boundary. */
+TEST_F(BinaryInputDeviceTest, test_method_putback) {
+    std::ifstream direct(FILE_NAME, std::ios::binary);
+    char raw[8];
+    direct.read(raw, 8);
+    BinaryInputDevice in(FILE_NAME, false, false, 3);
+    EXPECT_EQ(std::string(raw, 3), in.read(3));
+    // the peek refills the chunk which has to keep the byte read last
+    EXPECT_EQ((unsigned char)raw[3], in.peek());
+    in.putback(raw[2]);
+    EXPECT_EQ(std::string(raw + 2, 6), in.read(6));
+}
+
+/* Tests that a truncated file raises an error. */
+TEST_F(BinaryInputDeviceTest, test_truncated) {
+    BinaryInputDevice in(FILE_NAME, false, false, 8);
+    in.read(20);
+    EXPECT_THROW(in.read(1000), ProcessError);
+}
@@ -0,0 +1,155 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    CachingRouterTest.cpp
+/// @date    October 2026
+/// @version $Id$
+///
+// Tests the class CachingRouter
+/****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utils/vehicle/CachingRouter.h>
+
+
+class EdgeMock {
+};
+
+
+class VehicleMock {
+public:
+    VehicleMock(const double speedFactor) : mySpeedFactor(speedFactor) {}
+    SUMOVehicleClass getVClass() const {
+        return SVC_PASSENGER;
+    }
+    double getMaxSpeed() const {
+        return 50.;
+    }
+    double getChosenSpeedFactor() const {
+        return mySpeedFactor;
+    }
+private:
+    const double mySpeedFactor;
+};
+
+
+/// @brief routes along a line of edges and counts the computed routes
+class RouterMock : public SUMOAbstractRouter<EdgeMock, VehicleMock> {
+public:
+    RouterMock(const std::vector<const EdgeMock*>& line, int& numComputed) :
+        SUMOAbstractRouter<EdgeMock, VehicleMock>(nullptr, "RouterMock"), myLine(line), myNumComputed(numComputed) {}
+    SUMOAbstractRouter<EdgeMock, VehicleMock>* clone() {
+        return new RouterMock(myLine, myNumComputed);
+    }
+    bool compute(const EdgeMock* from, const EdgeMock* to, const VehicleMock* const, SUMOTime, std::vector<const EdgeMock*>& into) {
+        myNumComputed++;
+        std::vector<const EdgeMock*>::const_iterator start = std::find(myLine.begin(), myLine.end(), from);
+        std::vector<const EdgeMock*>::const_iterator end = std::find(start, myLine.end(), to);
+        if (end == myLine.end()) {
+            return false;
+        }
+        into.insert(into.end(), start, end + 1);
+        return true;
+    }
+    double recomputeCosts(const std::vector<const EdgeMock*>& edges, const VehicleMock* const, SUMOTime) const {
+        return (double)edges.size();
+    }
+private:
+    const std::vector<const EdgeMock*> myLine;
+    int& myNumComputed;
+};
+
+
+class CachingRouterTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        for (int i = 0; i < 4; i++) {
+            line.push_back(&edges[i]);
+        }
+        numComputed = 0;
+    }
+
+    std::vector<const EdgeMock*> route(CachingRouter<EdgeMock, VehicleMock>& router, int from, int to, const VehicleMock& vehicle) {
+        std::vector<const EdgeMock*> result;
+        router.compute(&edges[from], &edges[to], &vehicle, 0, result);
+        return result;
+    }
+
+    EdgeMock edges[4];
+    std::vector<const EdgeMock*> line;
+    int numComputed;
+};
+
+
+/* Test that a repeated query is answered from the cache*/
+TEST_F(CachingRouterTest, test_hit) {
+    CachingRouter<EdgeMock, VehicleMock>::Cache cache(10);
+    CachingRouter<EdgeMock, VehicleMock> router(new RouterMock(line, numComputed), cache);
+    const VehicleMock vehicle(1.);
+    EXPECT_EQ(line, route(router, 0, 3, vehicle));
+    EXPECT_EQ(line, route(router, 0, 3, vehicle));
+    EXPECT_EQ(1, numComputed);
+    EXPECT_EQ(1, cache.size());
+}
+
+/* Test that a query from an edge of a cached route is answered with its suffix*/
+TEST_F(CachingRouterTest, test_suffix_hit) {
+    CachingRouter<EdgeMock, VehicleMock>::Cache cache(10);
+    CachingRouter<EdgeMock, VehicleMock> router(new RouterMock(line, numComputed), cache);
+    const VehicleMock vehicle(1.);
+    route(router, 0, 3, vehicle);
+    EXPECT_EQ(std::vector<const EdgeMock*>(line.begin() + 2, line.end()), route(router, 2, 3, vehicle));
+    EXPECT_EQ(1, numComputed);
+    // a prefix is no valid answer
+    EXPECT_EQ(std::vector<const EdgeMock*>(line.begin(), line.begin() + 3), route(router, 0, 2, vehicle));
+    EXPECT_EQ(2, numComputed);
+}
+
+/* Test that vehicles with different speed factors do not share routes*/
+TEST_F(CachingRouterTest, test_miss_speedFactor) {
+    CachingRouter<EdgeMock, VehicleMock>::Cache cache(10);
+    CachingRouter<EdgeMock, VehicleMock> router(new RouterMock(line, numComputed), cache);
+    route(router, 0, 3, VehicleMock(1.));
+    route(router, 1, 3, VehicleMock(1.2));
+    EXPECT_EQ(2, numComputed);
+    route(router, 1, 3, VehicleMock(1.2));
+    EXPECT_EQ(2, numComputed);
+}
+
+/* Test that invalidated routes are computed again*/
+TEST_F(CachingRouterTest, test_invalidate) {
+    CachingRouter<EdgeMock, VehicleMock>::Cache cache(10);
+    CachingRouter<EdgeMock, VehicleMock> router(new RouterMock(line, numComputed), cache);
+    const VehicleMock vehicle(1.);
+    route(router, 0, 3, vehicle);
+    cache.invalidate();
+    EXPECT_EQ(std::vector<const EdgeMock*>(line.begin() + 1, line.end()), route(router, 1, 3, vehicle));
+    EXPECT_EQ(2, numComputed);
+    EXPECT_EQ(line, route(router, 0, 3, vehicle));
+    EXPECT_EQ(3, numComputed);
+    // the stale route is gone
+    EXPECT_EQ(2, cache.size());
+}
+
+/* Test that the least recently used route is evicted*/
+TEST_F(CachingRouterTest, test_evict) {
+    CachingRouter<EdgeMock, VehicleMock>::Cache cache(2);
+    CachingRouter<EdgeMock, VehicleMock> router(new RouterMock(line, numComputed), cache);
+    const VehicleMock vehicle(1.);
+    route(router, 0, 1, vehicle);
+    route(router, 1, 2, vehicle);
+    route(router, 0, 1, vehicle);
+    route(router, 2, 3, vehicle);
+    EXPECT_EQ(3, numComputed);
+    EXPECT_EQ(2, cache.size());
+    route(router, 0, 1, vehicle);
+    EXPECT_EQ(3, numComputed);
+    route(router, 1, 2, vehicle);
+    EXPECT_EQ(4, numComputed);
+}